@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *	Reed-Solomon erasure coding of Deluge pages.
+ *
+ *	The parity packets are computed with a Cauchy matrix over
+ *	GF(2^8). Since every square submatrix of a Cauchy matrix is
+ *	invertible, any N_PKT of the N_PKT + N_FEC_PKT packets of a
+ *	page suffice to rebuild the page.
+ */
+
+#include "contiki.h"
+#include "deluge.h"
+
+#include <string.h>
+
+#if N_FEC_PKT > 0
+
+/* The primitive polynomial x^8 + x^4 + x^3 + x^2 + 1. */
+#define GF_POLY		0x11d
+
+static uint8_t
+gf_mul(uint8_t a, uint8_t b)
+{
+  uint16_t x;
+  uint8_t r;
+
+  x = a;
+  r = 0;
+  while(b) {
+    if(b & 1) {
+      r ^= x;
+    }
+    x <<= 1;
+    if(x & 0x100) {
+      x ^= GF_POLY;
+    }
+    b >>= 1;
+  }
+  return r;
+}
+
+static uint8_t
+gf_inv(uint8_t a)
+{
+  uint8_t r;
+  int i;
+
+  /* a^254 is the multiplicative inverse of a in GF(2^8). */
+  r = a;
+  for(i = 0; i < 6; i++) {
+    r = gf_mul(gf_mul(r, r), a);
+  }
+  return gf_mul(r, r);
+}
+
+/* The coefficient of data packet i in parity packet j. The packet
+   numbers of the parity and data packets are distinct, so their sum
+   in GF(2^8) is never zero. */
+static uint8_t
+coefficient(unsigned j, unsigned i)
+{
+  return gf_inv((uint8_t)((N_PKT + j) ^ i));
+}
+
+/* dst += c * src, for S_PKT bytes. */
+static void
+add_scaled(unsigned char *dst, const unsigned char *src, uint8_t c)
+{
+  int i;
+
+  for(i = 0; i < S_PKT; i++) {
+    dst[i] ^= gf_mul(c, src[i]);
+  }
+}
+
+void
+deluge_fec_encode(const unsigned char *page, unsigned index,
+                  unsigned char *parity)
+{
+  unsigned i;
+
+  memset(parity, 0, S_PKT);
+  for(i = 0; i < N_PKT; i++) {
+    add_scaled(parity, &page[i * S_PKT], coefficient(index, i));
+  }
+}
+
+int
+deluge_fec_decode(unsigned char *page, uint32_t packet_set)
+{
+  uint8_t missing[N_FEC_PKT];
+  uint8_t rows[N_FEC_PKT];
+  uint8_t a[N_FEC_PKT][N_FEC_PKT];
+  uint8_t inv[N_FEC_PKT][N_FEC_PKT];
+  unsigned char *parity;
+  unsigned nmissing, nrows, i, j, k;
+  uint8_t c;
+
+  parity = &page[S_PAGE];
+
+  nmissing = 0;
+  for(i = 0; i < N_PKT; i++) {
+    if(!(packet_set & (1UL << i))) {
+      if(nmissing == N_FEC_PKT) {
+	return -1;
+      }
+      missing[nmissing++] = i;
+    }
+  }
+
+  nrows = 0;
+  for(j = 0; j < N_FEC_PKT && nrows < nmissing; j++) {
+    if(packet_set & (1UL << (N_PKT + j))) {
+      rows[nrows++] = j;
+    }
+  }
+
+  if(nrows < nmissing) {
+    return -1;
+  }
+
+  /* Remove the contribution of the received data packets from the
+     parity packets, leaving a system in the missing packets only. */
+  for(j = 0; j < nrows; j++) {
+    for(i = 0; i < N_PKT; i++) {
+      if(packet_set & (1UL << i)) {
+	add_scaled(&parity[rows[j] * S_PKT], &page[i * S_PKT],
+		   coefficient(rows[j], i));
+      }
+    }
+  }
+
+  /* Invert the submatrix of the missing packets with Gauss-Jordan
+     elimination. */
+  for(j = 0; j < nmissing; j++) {
+    for(k = 0; k < nmissing; k++) {
+      a[j][k] = coefficient(rows[j], missing[k]);
+      inv[j][k] = j == k;
+    }
+  }
+
+  for(k = 0; k < nmissing; k++) {
+    for(j = k; j < nmissing && a[j][k] == 0; j++);
+    if(j == nmissing) {
+      return -1;
+    }
+    if(j != k) {
+      for(i = 0; i < nmissing; i++) {
+	c = a[j][i]; a[j][i] = a[k][i]; a[k][i] = c;
+	c = inv[j][i]; inv[j][i] = inv[k][i]; inv[k][i] = c;
+      }
+    }
+    c = gf_inv(a[k][k]);
+    for(i = 0; i < nmissing; i++) {
+      a[k][i] = gf_mul(a[k][i], c);
+      inv[k][i] = gf_mul(inv[k][i], c);
+    }
+    for(j = 0; j < nmissing; j++) {
+      if(j != k && a[j][k] != 0) {
+	c = a[j][k];
+	for(i = 0; i < nmissing; i++) {
+	  a[j][i] ^= gf_mul(c, a[k][i]);
+	  inv[j][i] ^= gf_mul(c, inv[k][i]);
+	}
+      }
+    }
+  }
+
+  for(k = 0; k < nmissing; k++) {
+    memset(&page[missing[k] * S_PKT], 0, S_PKT);
+    for(j = 0; j < nmissing; j++) {
+      add_scaled(&page[missing[k] * S_PKT], &parity[rows[j] * S_PKT],
+		 inv[k][j]);
+    }
+  }
+
+  return 0;
+}
+
+#endif /* N_FEC_PKT > 0 */
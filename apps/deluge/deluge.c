@@ -157,6 +157,7 @@ init_page(struct deluge_object *obj, int pagenum, int have)
   page->flags = 0;
   page->last_request = 0;
   page->last_data = 0;
+  page->tx_set = 0;
 
   if(have) {
     page->version = obj->version;
@@ -203,8 +204,8 @@ init_object(struct deluge_object *obj, char *filename, unsigned version)
   obj->size = file_size(filename);
   obj->version = obj->update_version = version;
   obj->current_rx_page = 0;
+  obj->rx_window_end = 0;
   obj->nrequests = 0;
-  obj->tx_set = 0;
 
   obj->pages = malloc(OBJECT_PAGE_COUNT(*obj) * sizeof(*obj->pages));
   if(obj->pages == NULL) {
@@ -217,7 +218,7 @@ init_object(struct deluge_object *obj, char *filename, unsigned version)
     init_page(&current_object, i, 1);
   }
 
-  memset(obj->current_page, 0, sizeof(obj->current_page));
+  memset(obj->rx_pages, 0, sizeof(obj->rx_pages));
 
   return 0;
 }
@@ -236,22 +237,56 @@ highest_available_page(struct deluge_object *obj)
   return i;
 }
 
+static int
+page_received(struct deluge_page *page)
+{
+#if N_FEC_PKT > 0
+  uint32_t set;
+  int n;
+
+  /* Any N_PKT of the data and parity packets rebuild the page. */
+  n = 0;
+  for(set = page->packet_set & ALL_TX_PACKETS; set != 0; set &= set - 1) {
+    n++;
+  }
+  return n >= N_PKT;
+#else
+  return (page->packet_set & ALL_PACKETS) == ALL_PACKETS;
+#endif
+}
+
 static void
 send_request(void *arg)
 {
   struct deluge_object *obj;
   struct deluge_msg_request request;
+  struct deluge_page *page;
+  int i;
 
   obj = (struct deluge_object *)arg;
 
   request.cmd = DELUGE_CMD_REQUEST;
   request.pagenum = obj->current_rx_page;
   request.version = obj->pages[request.pagenum].version;
-  request.request_set = ~obj->pages[obj->current_rx_page].packet_set;
   request.object_id = obj->object_id;
 
-  PRINTF("Sending request for page %d, version %u, request_set %u\n", 
-	request.pagenum, request.version, request.request_set);
+  /* Request the missing packets of all pages in the window, so that
+     they are streamed without a round of summaries between pages. */
+  for(i = 0; i < DELUGE_PIPELINE_PAGES &&
+	request.pagenum + i < OBJECT_PAGE_COUNT(*obj); i++) {
+    page = &obj->pages[request.pagenum + i];
+    if(page->flags & PAGE_COMPLETE) {
+      request.request_set[i] = 0;
+    } else {
+      request.request_set[i] = ~page->packet_set & ALL_TX_PACKETS;
+    }
+  }
+  request.npages = i;
+  obj->rx_window_end = request.pagenum + i;
+
+  PRINTF("Sending request for page %d, version %u, request_set %u, %u pages\n",
+	request.pagenum, request.version, request.request_set[0],
+	request.npages);
   packetbuf_copyfrom(&request, sizeof(request));
   unicast_send(&deluge_uc, &obj->summary_from);
 
@@ -349,6 +384,7 @@ send_page(struct deluge_object *obj, unsigned pagenum)
   unsigned char buf[S_PAGE];
   struct deluge_msg_packet pkt;
   unsigned char *cp;
+  uint8_t tx_set;
 
   pkt.cmd = DELUGE_CMD_PACKET;
   pkt.pagenum = pagenum;
@@ -358,10 +394,12 @@ send_page(struct deluge_object *obj, unsigned pagenum)
   pkt.crc = 0;
 
   read_page(obj, pagenum, buf);
+  tx_set = obj->pages[pagenum].tx_set;
+  obj->pages[pagenum].tx_set = 0;
 
   /* Divide the page into packets and send them one at a time. */
   for(cp = buf; cp + S_PKT <= (unsigned char *)&buf[S_PAGE]; cp += S_PKT) {
-    if(obj->tx_set & (1 << pkt.packetnum)) {
+    if(tx_set & (1 << pkt.packetnum)) {
       pkt.crc = crc16_data(cp, S_PKT, 0);
       memcpy(pkt.payload, cp, S_PKT);
       packetbuf_copyfrom(&pkt, sizeof(pkt));
@@ -369,28 +407,57 @@ send_page(struct deluge_object *obj, unsigned pagenum)
     }
     pkt.packetnum++;
   }
-  obj->tx_set = 0;
+
+#if N_FEC_PKT > 0
+  /* The parity packets follow the data packets. */
+  for(; pkt.packetnum < N_TX_PKT; pkt.packetnum++) {
+    if(tx_set & (1 << pkt.packetnum)) {
+      deluge_fec_encode(buf, pkt.packetnum - N_PKT, pkt.payload);
+      pkt.crc = crc16_data(pkt.payload, S_PKT, 0);
+      packetbuf_copyfrom(&pkt, sizeof(pkt));
+      broadcast_send(&deluge_broadcast);
+    }
+  }
+#endif /* N_FEC_PKT > 0 */
+}
+
+static int
+next_tx_page(struct deluge_object *obj)
+{
+  int i;
+
+  for(i = 0; i < OBJECT_PAGE_COUNT(*obj); i++) {
+    if(obj->pages[i].tx_set) {
+      return i;
+    }
+  }
+  return -1;
 }
 
 static void
 tx_callback(void *arg)
 {
   struct deluge_object *obj;
+  int pagenum;
 
   obj = (struct deluge_object *)arg;
-  if(obj->current_tx_page >= 0 && obj->tx_set) {
-    send_page(obj, obj->current_tx_page);
-    /* Deluge T.2. */
-    if(obj->tx_set) {
-      packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
-			 PACKETBUF_ATTR_PACKET_TYPE_STREAM);
-      ctimer_reset(&tx_timer);
-    } else {
-      packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
-			 PACKETBUF_ATTR_PACKET_TYPE_STREAM_END);
-      obj->current_tx_page = -1;
-      transition(DELUGE_STATE_MAINTAIN);
-    }
+
+  /* Serve the lowest requested page first: it is the one that the
+     requesters need before they can make progress. */
+  pagenum = next_tx_page(obj);
+  if(pagenum >= 0) {
+    send_page(obj, pagenum);
+  }
+
+  /* Deluge T.2. */
+  if(next_tx_page(obj) >= 0) {
+    packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
+		       PACKETBUF_ATTR_PACKET_TYPE_STREAM);
+    ctimer_reset(&tx_timer);
+  } else {
+    packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
+		       PACKETBUF_ATTR_PACKET_TYPE_STREAM_END);
+    transition(DELUGE_STATE_MAINTAIN);
   }
 }
 
@@ -398,6 +465,9 @@ static void
 handle_request(struct deluge_msg_request *msg)
 {
   int highest_available;
+  struct deluge_page *page;
+  unsigned pagenum;
+  int i, requested;
 
   if(msg->pagenum >= OBJECT_PAGE_COUNT(current_object)) {
     return;
@@ -405,25 +475,34 @@ handle_request(struct deluge_msg_request *msg)
 
   if(msg->version != current_object.version) {
     neighbor_inconsistency = 1;
+    return;
   }
 
   highest_available = highest_available_page(&current_object);
 
-  /* Deluge M.6 */
-  if(msg->version == current_object.version &&
-      msg->pagenum <= highest_available) {
-    current_object.pages[msg->pagenum].last_request = clock_time();
-
-    /* Deluge T.1 */
-    if(msg->pagenum == current_object.current_tx_page) {
-      current_object.tx_set |= msg->request_set;
-    } else {
-      current_object.current_tx_page = msg->pagenum;
-      current_object.tx_set = msg->request_set;
+  /* Deluge M.6. We only serve pages that we have completed. */
+  requested = 0;
+  for(i = 0; i < msg->npages && i < DELUGE_PIPELINE_PAGES; i++) {
+    pagenum = msg->pagenum + i;
+    if(pagenum >= highest_available) {
+      break;
     }
+    page = &current_object.pages[pagenum];
+    page->last_request = clock_time();
+
+    /* Deluge T.1. Requests from several nodes are merged, so that
+       each requested packet is broadcast once for all of them. */
+    page->tx_set |= msg->request_set[i] & ALL_TX_PACKETS;
+    requested = 1;
+  }
 
+  if(requested) {
     transition(DELUGE_STATE_TX);
-    ctimer_set(&tx_timer, CLOCK_SECOND, tx_callback, &current_object);
+    /* The timer is not restarted by new requests, or a steady stream
+       of requests would keep us from sending anything. */
+    if(ctimer_expired(&tx_timer)) {
+      ctimer_set(&tx_timer, CLOCK_SECOND, tx_callback, &current_object);
+    }
   }
 }
 
@@ -433,6 +512,7 @@ handle_packet(struct deluge_msg_packet *msg)
   struct deluge_page *page;
   uint16_t crc;
   struct deluge_msg_packet packet;
+  uint8_t *buf;
 
   memcpy(&packet, msg, sizeof(packet));
 
@@ -440,7 +520,11 @@ handle_packet(struct deluge_msg_packet *msg)
 	(unsigned)packet.object_id, (unsigned)packet.version,
 	(unsigned)packet.pagenum, (unsigned)packet.packetnum);
 
-  if(packet.pagenum != current_object.current_rx_page) {
+  /* Accept packets for any page in the request window. */
+  if(packet.pagenum < current_object.current_rx_page ||
+     packet.pagenum >= current_object.current_rx_page + DELUGE_PIPELINE_PAGES ||
+     packet.pagenum >= OBJECT_PAGE_COUNT(current_object) ||
+     packet.packetnum >= N_TX_PKT) {
     return;
   }
 
@@ -449,37 +533,53 @@ handle_packet(struct deluge_msg_packet *msg)
   }
 
   page = &current_object.pages[packet.pagenum];
+  buf = current_object.rx_pages[packet.pagenum % DELUGE_PIPELINE_PAGES];
   if(packet.version == page->version && !(page->flags & PAGE_COMPLETE)) {
-    memcpy(&current_object.current_page[S_PKT * packet.packetnum],
-	packet.payload, S_PKT);
-
     crc = crc16_data(packet.payload, S_PKT, 0);
     if(packet.crc != crc) {
       PRINTF("packet crc: %hu, calculated crc: %hu\n", packet.crc, crc);
       return;
     }
 
+    memcpy(&buf[S_PKT * packet.packetnum], packet.payload, S_PKT);
+
     page->last_data = clock_time();
     page->packet_set |= (1 << packet.packetnum);
 
-    if(page->packet_set == ALL_PACKETS) {
+    if(page_received(page)) {
+#if N_FEC_PKT > 0
+      if((page->packet_set & ALL_PACKETS) != ALL_PACKETS) {
+	if(deluge_fec_decode(buf, page->packet_set) < 0) {
+	  PRINTF("Failed to decode page %u\n", packet.pagenum);
+	  page->packet_set = 0;
+	  return;
+	}
+	PRINTF("Rebuilt page %u from parity packets\n", packet.pagenum);
+      }
+#endif /* N_FEC_PKT > 0 */
+
       /* This is the last packet of the requested page; stop streaming. */
       packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
 			 PACKETBUF_ATTR_PACKET_TYPE_STREAM_END);
 
-      write_page(&current_object, packet.pagenum, current_object.current_page);
+      write_page(&current_object, packet.pagenum, buf);
       page->version = packet.version;
+      page->packet_set = ALL_PACKETS;
       page->flags = PAGE_COMPLETE;
       PRINTF("Page %u completed\n", packet.pagenum);
 
-      current_object.current_rx_page++;
+      /* Pages later in the window may already be complete. */
+      current_object.current_rx_page = highest_available_page(&current_object);
 
-      if(packet.pagenum == OBJECT_PAGE_COUNT(current_object) - 1) {
+      if(current_object.current_rx_page == OBJECT_PAGE_COUNT(current_object)) {
 	current_object.version = current_object.update_version;
 	leds_on(LEDS_RED);
 	PRINTF("Update completed for object %u, version %u\n", 
 	       (unsigned)current_object.object_id, packet.version);
-      } else if(current_object.current_rx_page < OBJECT_PAGE_COUNT(current_object)) {
+      } else if(current_object.current_rx_page < current_object.rx_window_end) {
+	/* More pages of the window are still being streamed. */
+	return;
+      } else {
         if(ctimer_expired(&rx_timer)) {
 	  ctimer_set(&rx_timer,
 		CONST_OMEGA * ESTIMATED_TX_TIME + (random_rand() % T_R),
@@ -537,7 +637,6 @@ handle_profile(struct deluge_msg_profile *msg)
 	msg->version, msg->npages);
 
   leds_off(LEDS_RED);
-  current_object.tx_set = 0;
 
   npages = OBJECT_PAGE_COUNT(*obj);
   obj->size = msg->npages * S_PAGE;
@@ -557,6 +656,7 @@ handle_profile(struct deluge_msg_profile *msg)
   }
 
   for(i = 0; i < npages; i++) {
+    obj->pages[i].tx_set = 0;
     if(msg->version_vector[i] > obj->pages[i].version) {
       obj->pages[i].packet_set = 0;
       obj->pages[i].flags &= ~PAGE_COMPLETE;
@@ -64,6 +64,31 @@ PROCESS_NAME(deluge_process);
 #define N_PKT		4		/* Packets per page. */
 #define S_PAGE		(S_PKT * N_PKT)	/* Fixed page size. */
 
+/* The number of Reed-Solomon parity packets that are sent with each
+   page. A receiver can rebuild a page from any N_PKT of the data and
+   parity packets, so up to N_FEC_PKT lost packets per page are
+   recovered without a new request. */
+#ifdef DELUGE_CONF_FEC_PACKETS
+#define N_FEC_PKT	DELUGE_CONF_FEC_PACKETS
+#else
+#define N_FEC_PKT	0
+#endif
+
+/* Data and parity packets per page. */
+#define N_TX_PKT	(N_PKT + N_FEC_PKT)
+
+#if N_TX_PKT > 8
+#error "Deluge supports at most 8 data and parity packets per page."
+#endif
+
+/* The number of consecutive pages that a node requests and receives
+   at a time. */
+#ifdef DELUGE_CONF_PIPELINE_PAGES
+#define DELUGE_PIPELINE_PAGES	DELUGE_CONF_PIPELINE_PAGES
+#else
+#define DELUGE_PIPELINE_PAGES	1
+#endif
+
 /* Bounds for the round time in seconds. */
 #define T_LOW		2
 #define T_HIGH		64
@@ -78,6 +103,7 @@ PROCESS_NAME(deluge_process);
 #define OBJECT_PAGE_COUNT(obj)	(((obj).size + (S_PAGE - 1)) / S_PAGE)
 
 #define ALL_PACKETS		((1 << N_PKT) - 1)
+#define ALL_TX_PACKETS		((1 << N_TX_PKT) - 1)
 
 #define DELUGE_CMD_SUMMARY	1
 #define DELUGE_CMD_REQUEST	2
@@ -107,8 +133,10 @@ struct deluge_msg_request {
   uint8_t cmd;
   uint8_t version;
   uint8_t pagenum;
-  uint8_t request_set;
+  uint8_t npages;
   deluge_object_id_t object_id;
+  /* The requested packets of the pages pagenum to pagenum + npages - 1. */
+  uint8_t request_set[DELUGE_PIPELINE_PAGES];
 };
 
 struct deluge_msg_packet {
@@ -137,10 +165,12 @@ struct deluge_object {
   uint8_t update_version;
   struct deluge_page *pages;
   uint8_t current_rx_page;
-  int8_t current_tx_page;
+  uint8_t rx_window_end;
   uint8_t nrequests;
-  uint8_t current_page[S_PAGE];
-  uint8_t tx_set;
+  /* Receive buffers for the pages in the request window, indexed by
+     the page number modulo DELUGE_PIPELINE_PAGES. The parity packets
+     are stored after the page data. */
+  uint8_t rx_pages[DELUGE_PIPELINE_PAGES][S_PAGE + N_FEC_PKT * S_PKT];
   int cfs_fd;
   rimeaddr_t summary_from;
 };
@@ -152,8 +182,13 @@ struct deluge_page {
   clock_time_t last_data;
   uint8_t flags;
   uint8_t version;
+  uint8_t tx_set;
 };
 
 int deluge_disseminate(char *file, unsigned version);
 
+void deluge_fec_encode(const unsigned char *page, unsigned index,
+                       unsigned char *parity);
+int deluge_fec_decode(unsigned char *page, uint32_t packet_set);
+
 #endif
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A streaming JSON parser.
+ */
+
+#include "jsonstream.h"
+#include <string.h>
+
+enum {
+  ST_VALUE,
+  ST_VALUE_OR_END,
+  ST_NAME,
+  ST_NAME_OR_END,
+  ST_COLON,
+  ST_AFTER_VALUE,
+  ST_STRING,
+  ST_NAME_STRING,
+  ST_TOKEN,
+  ST_DONE,
+  ST_STOPPED,
+  ST_ERROR
+};
+
+/*--------------------------------------------------------------------*/
+static void
+emit(struct jsonstream_state *state, char type, const char *value, int len)
+{
+  if(state->callback != NULL && state->callback(state, type, value, len)) {
+    state->state = ST_STOPPED;
+  }
+}
+/*--------------------------------------------------------------------*/
+static int
+error(struct jsonstream_state *state, int error)
+{
+  state->state = ST_ERROR;
+  state->error = error;
+  return error;
+}
+/*--------------------------------------------------------------------*/
+/* Find the component of a path at a certain depth. */
+static const char *
+component(const char *path, int depth, int *len)
+{
+  const char *end;
+
+  for(; depth > 0; depth--) {
+    path = strchr(path, '.');
+    if(path == NULL) {
+      return NULL;
+    }
+    path++;
+  }
+  end = strchr(path, '.');
+  *len = end == NULL ? strlen(path) : end - path;
+  return path;
+}
+/*--------------------------------------------------------------------*/
+static int
+num_components(const char *path)
+{
+  int n;
+
+  for(n = 1; (path = strchr(path, '.')) != NULL; path++) {
+    n++;
+  }
+  return n;
+}
+/*--------------------------------------------------------------------*/
+/* The fields whose paths lead to the value that starts at the current
+   position. */
+static uint16_t
+candidates(struct jsonstream_state *state)
+{
+  const char *c;
+  char index[6];
+  uint16_t mask;
+  int i, n, len, d;
+
+  d = state->depth;
+  if(d == 0) {
+    return state->match[0];
+  }
+  if(state->stack[d - 1] == JSON_TYPE_OBJECT) {
+    return state->name_match;
+  }
+
+  mask = state->match[d];
+  if(mask == 0) {
+    return 0;
+  }
+  /* Array elements are matched by their decimal index. */
+  n = sizeof(index);
+  i = state->index[d - 1];
+  do {
+    index[--n] = '0' + i % 10;
+    i /= 10;
+  } while(i > 0);
+  for(i = 0; i < state->num_fields; i++) {
+    if(mask & (1 << i)) {
+      c = component(state->fields[i].path, d - 1, &len);
+      if(c == NULL || len != sizeof(index) - n ||
+         memcmp(c, &index[n], len) != 0) {
+        mask &= ~(1 << i);
+      }
+    }
+  }
+  return mask;
+}
+/*--------------------------------------------------------------------*/
+/* Set up the extraction of a value, and return the fields whose paths
+   continue into it. */
+static uint16_t
+start_value(struct jsonstream_state *state, char type)
+{
+  struct jsonstream_field *f;
+  uint16_t cur, deeper;
+  int i;
+
+  state->value_match = 0;
+  if(state->num_fields == 0) {
+    return 0;
+  }
+  cur = candidates(state);
+  deeper = 0;
+  for(i = 0; i < state->num_fields; i++) {
+    if(cur & (1 << i)) {
+      f = &state->fields[i];
+      if(num_components(f->path) == state->depth) {
+        f->type = type;
+        f->len = 0;
+        if(f->size > 0) {
+          f->buf[0] = '\0';
+        }
+        if(type != JSON_TYPE_OBJECT && type != JSON_TYPE_ARRAY) {
+          state->value_match |= 1 << i;
+        }
+      } else {
+        deeper |= 1 << i;
+      }
+    }
+  }
+  return deeper;
+}
+/*--------------------------------------------------------------------*/
+static void
+copy_value(struct jsonstream_state *state, const char *value, int len)
+{
+  struct jsonstream_field *f;
+  int i, n;
+
+  for(i = 0; i < state->num_fields; i++) {
+    if(state->value_match & (1 << i)) {
+      f = &state->fields[i];
+      n = f->size - 1 - f->len;
+      if(n > len) {
+        n = len;
+      }
+      if(n > 0) {
+        memcpy(&f->buf[f->len], value, n);
+        f->len += n;
+        f->buf[f->len] = '\0';
+      }
+    }
+  }
+}
+/*--------------------------------------------------------------------*/
+static void
+match_name(struct jsonstream_state *state, const char *name, int len,
+           int last)
+{
+  const char *c;
+  int i, clen;
+
+  for(i = 0; i < state->num_fields; i++) {
+    if(state->name_match & (1 << i)) {
+      c = component(state->fields[i].path, state->depth - 1, &clen);
+      if(c == NULL || state->name_len + len > clen ||
+         memcmp(c + state->name_len, name, len) != 0 ||
+         (last && state->name_len + len != clen)) {
+        state->name_match &= ~(1 << i);
+      }
+    }
+  }
+  state->name_len += len;
+}
+/*--------------------------------------------------------------------*/
+static void
+string_token(struct jsonstream_state *state, const char *value, int len,
+             int more)
+{
+  state->more = more;
+  if(state->state == ST_NAME_STRING) {
+    if(state->name_match != 0) {
+      match_name(state, value, len, !more);
+    }
+    emit(state, JSON_TYPE_PAIR_NAME, value, len);
+  } else {
+    if(state->value_match != 0) {
+      copy_value(state, value, len);
+    }
+    emit(state, JSON_TYPE_STRING, value, len);
+  }
+  state->more = 0;
+}
+/*--------------------------------------------------------------------*/
+static void
+end_value(struct jsonstream_state *state)
+{
+  if(state->state != ST_STOPPED) {
+    state->state = state->depth == 0 ? ST_DONE : ST_AFTER_VALUE;
+  }
+}
+/*--------------------------------------------------------------------*/
+static int
+end_token(struct jsonstream_state *state, const char *value, int len)
+{
+  char type;
+
+  type = state->token;
+  if(type != JSON_TYPE_NUMBER) {
+    if(len == 4 && memcmp(value, "true", 4) == 0) {
+      type = JSON_TYPE_TRUE;
+    } else if(len == 5 && memcmp(value, "false", 5) == 0) {
+      type = JSON_TYPE_FALSE;
+    } else if(len == 4 && memcmp(value, "null", 4) == 0) {
+      type = JSON_TYPE_NULL;
+    } else {
+      return error(state, JSON_ERROR_SYNTAX);
+    }
+  }
+  if(state->num_fields > 0) {
+    start_value(state, type);
+    copy_value(state, value, len);
+  }
+  emit(state, type, value, len);
+  end_value(state);
+  return JSON_ERROR_OK;
+}
+/*--------------------------------------------------------------------*/
+static int
+begin_container(struct jsonstream_state *state, char type)
+{
+  uint16_t deeper;
+
+  if(state->depth == JSONSTREAM_MAX_DEPTH) {
+    return error(state, JSON_ERROR_TOO_DEEP);
+  }
+  deeper = start_value(state, type);
+  state->stack[state->depth] = type;
+  state->index[state->depth] = 0;
+  state->depth++;
+  state->match[state->depth] = deeper;
+  state->state = type == JSON_TYPE_OBJECT ? ST_NAME_OR_END : ST_VALUE_OR_END;
+  emit(state, type, NULL, 0);
+  return JSON_ERROR_OK;
+}
+/*--------------------------------------------------------------------*/
+static int
+end_container(struct jsonstream_state *state, char c)
+{
+  if(state->depth == 0 ||
+     state->stack[state->depth - 1] != (c == '}' ? JSON_TYPE_OBJECT :
+                                        JSON_TYPE_ARRAY)) {
+    return error(state, c == ']' ? JSON_ERROR_UNEXPECTED_END_OF_ARRAY :
+                 JSON_ERROR_SYNTAX);
+  }
+  state->depth--;
+  state->state = ST_AFTER_VALUE;
+  emit(state, c, NULL, 0);
+  end_value(state);
+  return JSON_ERROR_OK;
+}
+/*--------------------------------------------------------------------*/
+static int
+start_value_char(struct jsonstream_state *state, char c)
+{
+  switch(c) {
+  case '{':
+    return begin_container(state, JSON_TYPE_OBJECT);
+  case '[':
+    return begin_container(state, JSON_TYPE_ARRAY);
+  case '"':
+    start_value(state, JSON_TYPE_STRING);
+    state->state = ST_STRING;
+    return JSON_ERROR_OK;
+  default:
+    if((c >= '0' && c <= '9') || c == '-') {
+      state->token = JSON_TYPE_NUMBER;
+    } else if(c == 't' || c == 'f' || c == 'n') {
+      state->token = JSON_TYPE_TRUE;
+    } else {
+      return error(state, state->depth > 0 &&
+                   state->stack[state->depth - 1] == JSON_TYPE_ARRAY ?
+                   JSON_ERROR_UNEXPECTED_END_OF_ARRAY : JSON_ERROR_SYNTAX);
+    }
+    /* A number or a literal is extracted at its end, when its type
+       is known. */
+    state->number_len = 0;
+    state->state = ST_TOKEN;
+    return JSON_ERROR_OK;
+  }
+}
+/*--------------------------------------------------------------------*/
+static int
+is_token_char(char token, char c)
+{
+  if(token == JSON_TYPE_NUMBER) {
+    return (c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' ||
+      c == 'e' || c == 'E';
+  }
+  return c >= 'a' && c <= 'z';
+}
+/*--------------------------------------------------------------------*/
+void
+jsonstream_init(struct jsonstream_state *state,
+                jsonstream_callback_t callback, void *ptr)
+{
+  memset(state, 0, sizeof(*state));
+  state->callback = callback;
+  state->ptr = ptr;
+  state->state = ST_VALUE;
+}
+/*--------------------------------------------------------------------*/
+void
+jsonstream_extract(struct jsonstream_state *state,
+                   struct jsonstream_field *fields, int num)
+{
+  int i;
+
+  if(num > JSONSTREAM_MAX_FIELDS) {
+    num = JSONSTREAM_MAX_FIELDS;
+  }
+  state->fields = fields;
+  state->num_fields = num;
+  state->match[0] = 0;
+  for(i = 0; i < num; i++) {
+    state->match[0] |= 1 << i;
+    fields[i].type = JSON_TYPE_ERROR;
+    fields[i].len = 0;
+    if(fields[i].size > 0) {
+      fields[i].buf[0] = '\0';
+    }
+  }
+}
+/*--------------------------------------------------------------------*/
+int
+jsonstream_feed(struct jsonstream_state *state, const char *buf, int len)
+{
+  int i, start, n;
+  char c;
+
+  i = 0;
+  while(i < len) {
+    switch(state->state) {
+    case ST_STRING:
+    case ST_NAME_STRING:
+      /* Scan for the end of the string, which is the bulk of most
+         documents. */
+      start = i;
+      while(i < len) {
+        c = buf[i];
+        if(state->escape) {
+          state->escape = 0;
+        } else if(c == '\\') {
+          state->escape = 1;
+        } else if(c == '"') {
+          break;
+        }
+        i++;
+      }
+      if(i == len) {
+        if(i > start) {
+          string_token(state, &buf[start], i - start, 1);
+        }
+      } else {
+        string_token(state, &buf[start], i - start, 0);
+        i++;
+        if(state->state == ST_NAME_STRING) {
+          state->state = ST_COLON;
+        } else {
+          end_value(state);
+        }
+      }
+      break;
+
+    case ST_TOKEN:
+      start = i;
+      while(i < len && is_token_char(state->token, buf[i])) {
+        i++;
+      }
+      n = i - start;
+      if(i < len && state->number_len == 0) {
+        /* The whole token is in this chunk. */
+        if(n == 0) {
+          return error(state, JSON_ERROR_SYNTAX);
+        }
+        end_token(state, &buf[start], n);
+        break;
+      }
+      if(state->number_len + n > JSONSTREAM_NUMBER_SIZE) {
+        return error(state, JSON_ERROR_TOKEN_TOO_LONG);
+      }
+      memcpy(&state->number[state->number_len], &buf[start], n);
+      state->number_len += n;
+      if(i < len) {
+        end_token(state, state->number, state->number_len);
+      }
+      break;
+
+    default:
+      c = buf[i++];
+      if(c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+        break;
+      }
+      switch(state->state) {
+      case ST_VALUE_OR_END:
+        if(c == ']') {
+          end_container(state, c);
+          break;
+        }
+        /* Fall through. */
+      case ST_VALUE:
+        if(start_value_char(state, c) == JSON_ERROR_OK &&
+           state->state == ST_TOKEN) {
+          /* Let the token state see the first character. */
+          i--;
+        }
+        break;
+      case ST_NAME_OR_END:
+        if(c == '}') {
+          end_container(state, c);
+          break;
+        }
+        /* Fall through. */
+      case ST_NAME:
+        if(c != '"') {
+          return error(state, JSON_ERROR_SYNTAX);
+        }
+        state->name_match = state->match[state->depth];
+        state->name_len = 0;
+        state->state = ST_NAME_STRING;
+        break;
+      case ST_COLON:
+        if(c != ':') {
+          return error(state, JSON_ERROR_SYNTAX);
+        }
+        state->state = ST_VALUE;
+        break;
+      case ST_AFTER_VALUE:
+        if(c == ',') {
+          if(state->stack[state->depth - 1] == JSON_TYPE_OBJECT) {
+            state->state = ST_NAME;
+          } else {
+            state->index[state->depth - 1]++;
+            state->state = ST_VALUE;
+          }
+        } else if(c == '}' || c == ']') {
+          end_container(state, c);
+        } else {
+          return error(state, JSON_ERROR_SYNTAX);
+        }
+        break;
+      case ST_DONE:
+        return error(state, JSON_ERROR_SYNTAX);
+      case ST_STOPPED:
+        return JSON_ERROR_OK;
+      default:
+        return state->error;
+      }
+    }
+    if(state->state == ST_STOPPED) {
+      return JSON_ERROR_OK;
+    }
+    if(state->state == ST_ERROR) {
+      return state->error;
+    }
+  }
+  return JSON_ERROR_OK;
+}
+/*--------------------------------------------------------------------*/
+int
+jsonstream_finish(struct jsonstream_state *state)
+{
+  if(state->state == ST_TOKEN && state->depth == 0) {
+    /* A number or a literal at the top level ends with the document. */
+    end_token(state, state->number, state->number_len);
+  }
+  if(state->state == ST_ERROR) {
+    return state->error;
+  }
+  if(state->state != ST_DONE && state->state != ST_STOPPED) {
+    return error(state, JSON_ERROR_INCOMPLETE);
+  }
+  return JSON_ERROR_OK;
+}
+/*--------------------------------------------------------------------*/
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A streaming JSON parser.
+ *
+ *         The document is fed to the parser in chunks of any size, as
+ *         they arrive in CoAP blocks or HTTP segments. Every token is
+ *         reported to a callback as a pointer into the chunk and a
+ *         length, without copying. Strings that are split between
+ *         chunks are reported in fragments, with jsonstream_more()
+ *         true for all but the last. Numbers split between chunks are
+ *         joined in a small buffer in the parser state.
+ *
+ *         Strings are reported as they appear in the document, with
+ *         their escape sequences.
+ *
+ *         Instead of, or in addition to, a callback, the parser can
+ *         extract the values at a list of paths, such as
+ *         "config.interval" or "readings.2.value", into buffers of
+ *         their own. Nothing else is copied.
+ */
+
+#ifndef __JSONSTREAM_H__
+#define __JSONSTREAM_H__
+
+#include "contiki-conf.h"
+#include "json.h"
+
+#ifdef JSONSTREAM_CONF_MAX_DEPTH
+#define JSONSTREAM_MAX_DEPTH JSONSTREAM_CONF_MAX_DEPTH
+#else
+#define JSONSTREAM_MAX_DEPTH 10
+#endif
+
+/* The longest number that can be split between chunks. */
+#ifdef JSONSTREAM_CONF_NUMBER_SIZE
+#define JSONSTREAM_NUMBER_SIZE JSONSTREAM_CONF_NUMBER_SIZE
+#else
+#define JSONSTREAM_NUMBER_SIZE 24
+#endif
+
+/* The largest number of fields that can be extracted at once. */
+#define JSONSTREAM_MAX_FIELDS 16
+
+struct jsonstream_state;
+
+/**
+ * The callback that receives the tokens of a document.
+ *
+ * \param state The parser state.
+ * \param type The type of the token: JSON_TYPE_OBJECT or
+ *             JSON_TYPE_ARRAY at the start of a container, '}' or ']'
+ *             at its end, JSON_TYPE_PAIR_NAME for the name of a
+ *             member, and JSON_TYPE_STRING, JSON_TYPE_NUMBER,
+ *             JSON_TYPE_TRUE, JSON_TYPE_FALSE or JSON_TYPE_NULL for
+ *             a value.
+ * \param value The text of the token. It is only valid during the call.
+ * \param len The length of the token.
+ * \return Zero to continue parsing, non-zero to stop.
+ */
+typedef int (* jsonstream_callback_t)(struct jsonstream_state *state,
+                                      char type, const char *value,
+                                      int len);
+
+/**
+ * A value to extract from a document.
+ *
+ * The path consists of the names of the members and the indices of
+ * the array elements that lead to the value, separated by dots. When
+ * the value is found, type is set to its type and its text is copied
+ * to buf, NUL terminated and truncated to size - 1 characters. The
+ * value of a field that is an object or an array is not copied, only
+ * its type is set.
+ */
+struct jsonstream_field {
+  const char *path;
+  char *buf;
+  int size;
+  int len;
+  char type;
+};
+
+struct jsonstream_state {
+  jsonstream_callback_t callback;
+  void *ptr;
+  struct jsonstream_field *fields;
+  unsigned char num_fields;
+  char state;
+  char error;
+  char more;
+  char escape;
+  unsigned char depth;
+  /* The type of the number or literal being parsed. */
+  char token;
+  char stack[JSONSTREAM_MAX_DEPTH];
+  /* The index of the current element of each array. */
+  uint16_t index[JSONSTREAM_MAX_DEPTH];
+  /* The fields whose paths match the containers at each depth. */
+  uint16_t match[JSONSTREAM_MAX_DEPTH + 1];
+  /* The fields whose paths match the current member name. */
+  uint16_t name_match;
+  /* The fields that receive the current value. */
+  uint16_t value_match;
+  /* How much of the current member name has been matched. */
+  uint16_t name_len;
+  unsigned char number_len;
+  char number[JSONSTREAM_NUMBER_SIZE];
+};
+
+/**
+ * \brief      Initialize a streaming JSON parser.
+ * \param state A pointer to a parser state
+ * \param callback The callback that receives the tokens, or NULL
+ * \param ptr An opaque pointer for the callback
+ */
+void jsonstream_init(struct jsonstream_state *state,
+                     jsonstream_callback_t callback, void *ptr);
+
+/**
+ * \brief      Extract the values at a list of paths.
+ * \param state A pointer to a parser state
+ * \param fields The fields to extract
+ * \param num The number of fields, at most JSONSTREAM_MAX_FIELDS
+ *
+ *             Must be called after jsonstream_init() and before the
+ *             first chunk is fed to the parser.
+ */
+void jsonstream_extract(struct jsonstream_state *state,
+                        struct jsonstream_field *fields, int num);
+
+/**
+ * \brief      Feed a chunk of the document to the parser.
+ * \param state A pointer to a parser state
+ * \param buf The chunk
+ * \param len The length of the chunk
+ * \return JSON_ERROR_OK, or the error that stopped the parser.
+ *
+ *             If the callback stops the parser, JSON_ERROR_OK is
+ *             returned and the rest of the document is ignored.
+ */
+int jsonstream_feed(struct jsonstream_state *state, const char *buf,
+                    int len);
+
+/**
+ * \brief      Signal the end of the document.
+ * \return JSON_ERROR_OK if the document was complete.
+ */
+int jsonstream_finish(struct jsonstream_state *state);
+
+/* Non-zero in the callback if the string token continues in the next
+   call. */
+#define jsonstream_more(state) ((state)->more)
+
+/* The nesting depth of the current token. */
+#define jsonstream_depth(state) ((state)->depth)
+
+#endif /* __JSONSTREAM_H__ */
@@ -50,6 +50,54 @@
 #define PRINTF(...)
 #endif
 
+/* The buffer of print_chunk(). */
+static char *out_buf;
+static int out_size;
+static int out_pos;
+static int32_t out_skip;
+static int out_lost;
+/*---------------------------------------------------------------------------*/
+static void
+write_buffer(const char *text, int len)
+{
+  int n;
+
+  if(out_skip > 0) {
+    n = len < out_skip ? len : (int)out_skip;
+    out_skip -= n;
+    text += n;
+    len -= n;
+  }
+  n = out_size - out_pos;
+  if(n > len) {
+    n = len;
+  }
+  memcpy(&out_buf[out_pos], text, n);
+  out_pos += n;
+  out_lost += len - n;
+}
+/*---------------------------------------------------------------------------*/
+static int
+chunk_putchar(int c)
+{
+  char ch;
+
+  ch = c;
+  write_buffer(&ch, 1);
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+static void
+write_text(const struct jsontree_context *js_ctx, const char *text, int len)
+{
+  if(js_ctx->putchar == chunk_putchar) {
+    write_buffer(text, len);
+  } else {
+    while(len-- > 0) {
+      js_ctx->putchar(*text++);
+    }
+  }
+}
 /*---------------------------------------------------------------------------*/
 void
 jsontree_write_atom(const struct jsontree_context *js_ctx, const char *text)
@@ -57,22 +105,25 @@ jsontree_write_atom(const struct jsontree_context *js_ctx, const char *text)
   if(text == NULL) {
     js_ctx->putchar('0');
   } else {
-    while(*text != '\0') {
-      js_ctx->putchar(*text++);
-    }
+    write_text(js_ctx, text, strlen(text));
   }
 }
 /*---------------------------------------------------------------------------*/
 void
 jsontree_write_string(const struct jsontree_context *js_ctx, const char *text)
 {
+  const char *end;
+
   js_ctx->putchar('"');
   if(text != NULL) {
     while(*text != '\0') {
-      if(*text == '"') {
-        js_ctx->putchar('\\');
+      for(end = text; *end != '\0' && *end != '"'; end++);
+      write_text(js_ctx, text, end - text);
+      if(*end == '"') {
+        write_text(js_ctx, "\\\"", 2);
+        end++;
       }
-      js_ctx->putchar(*text++);
+      text = end;
     }
   }
   js_ctx->putchar('"');
@@ -81,23 +132,25 @@ jsontree_write_string(const struct jsontree_context *js_ctx, const char *text)
 void
 jsontree_write_int(const struct jsontree_context *js_ctx, int value)
 {
-  char buf[10];
+  char buf[11];
   int l;
+  int negative;
 
-  if(value < 0) {
-    js_ctx->putchar('-');
+  negative = value < 0;
+  if(negative) {
     value = -value;
   }
 
-  l = sizeof(buf) - 1;
+  l = sizeof(buf);
   do {
-    buf[l--] = '0' + (value % 10);
+    buf[--l] = '0' + (value % 10);
     value /= 10;
-  } while(value > 0 && l >= 0);
+  } while(value > 0 && l > 1);
 
-  while(++l < sizeof(buf)) {
-    js_ctx->putchar(buf[l]);
+  if(negative) {
+    buf[--l] = '-';
   }
+  write_text(js_ctx, &buf[l], sizeof(buf) - l);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -115,6 +168,9 @@ jsontree_reset(struct jsontree_context *js_ctx)
 {
   js_ctx->depth = 0;
   js_ctx->index[0] = 0;
+  js_ctx->skip = 0;
+  js_ctx->done = 0;
+  js_ctx->offset = 0;
 }
 /*---------------------------------------------------------------------------*/
 const char *
@@ -212,6 +268,103 @@ jsontree_print_next(struct jsontree_context *js_ctx)
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+/*
+ * Writes the output from where the previous call stopped until buf is
+ * full. With whole_steps set, a step that does not fit in the rest of
+ * the buffer but would fit in an empty one is left for the next call,
+ * instead of being written in two parts.
+ */
+static int
+print_chunk(struct jsontree_context *js_ctx, char *buf, int size,
+            int whole_steps)
+{
+  int (* saved_putchar)(int);
+  uint8_t depth;
+  uint16_t index;
+  uint16_t parent_index;
+  int callback_state;
+  int start;
+  int32_t skip;
+  int more;
+
+  out_buf = buf;
+  out_size = size;
+  out_pos = 0;
+  out_skip = js_ctx->skip;
+  saved_putchar = js_ctx->putchar;
+  js_ctx->putchar = chunk_putchar;
+
+  while(!js_ctx->done) {
+    /* A step changes at most these, so they are enough to take it
+       again if its output does not fit. */
+    depth = js_ctx->depth;
+    index = js_ctx->index[depth];
+    parent_index = depth > 0 ? js_ctx->index[depth - 1] : 0;
+    callback_state = js_ctx->callback_state;
+    start = out_pos;
+    skip = out_skip;
+    out_lost = 0;
+
+    more = jsontree_print_next(js_ctx) && js_ctx->path <= js_ctx->depth;
+
+    if(out_lost > 0) {
+      js_ctx->depth = depth;
+      js_ctx->index[depth] = index;
+      if(depth > 0) {
+        js_ctx->index[depth - 1] = parent_index;
+      }
+      js_ctx->callback_state = callback_state;
+      if(whole_steps && skip == 0 && start > 0 &&
+         out_pos - start + out_lost <= size) {
+        /* Take all of the step in the next call, so that the output
+           of a callback comes from a single call of it. */
+        out_pos = start;
+        js_ctx->skip = 0;
+      } else {
+        /* The part of the step that was skipped or written. */
+        js_ctx->skip = (skip - out_skip) + (out_pos - start);
+      }
+      break;
+    }
+    js_ctx->skip = out_skip;
+    if(!more) {
+      js_ctx->done = 1;
+    }
+  }
+
+  js_ctx->putchar = saved_putchar;
+  js_ctx->offset += out_pos;
+  return out_pos;
+}
+/*---------------------------------------------------------------------------*/
+int
+jsontree_print_chunk(struct jsontree_context *js_ctx, char *buf, int size)
+{
+  return print_chunk(js_ctx, buf, size, 1);
+}
+/*---------------------------------------------------------------------------*/
+int
+jsontree_print_block(struct jsontree_context *js_ctx, char *buf, int size,
+                     int32_t *offset)
+{
+  int len;
+
+  if(*offset != js_ctx->offset) {
+    /* Not the next block: start over and skip to the offset. */
+    jsontree_reset(js_ctx);
+    js_ctx->skip = *offset;
+    js_ctx->offset = *offset;
+  }
+
+  len = print_chunk(js_ctx, buf, size, 0);
+  if(js_ctx->done) {
+    *offset = -1;
+  } else {
+    *offset += len;
+  }
+  return len;
+}
+/*---------------------------------------------------------------------------*/
 static struct jsontree_value *
 find_next(struct jsontree_context *js_ctx)
 {
@@ -56,6 +56,12 @@ struct jsontree_context {
   uint8_t depth;
   uint8_t path;
   int callback_state;
+  /* The number of bytes of the next step that have already been
+     written by jsontree_print_chunk(). */
+  int32_t skip;
+  uint8_t done;
+  /* The number of bytes written by jsontree_print_chunk(). */
+  int32_t offset;
 };
 
 struct jsontree_value {
@@ -129,6 +135,54 @@ void jsontree_write_atom(const struct jsontree_context *js_ctx,
 void jsontree_write_string(const struct jsontree_context *js_ctx,
                            const char *text);
 int jsontree_print_next(struct jsontree_context *js_ctx);
+
+/**
+ * \brief      Write the next part of the output to a buffer.
+ * \param js_ctx The context, set up with jsontree_setup()
+ * \param buf The buffer
+ * \param size The size of the buffer
+ * \return The number of bytes written, zero only at the end.
+ *
+ *             Each call continues exactly where the previous one
+ *             stopped, without walking the tree from the start. A
+ *             value that does not fit in the rest of the buffer is
+ *             left for the next call, so that it is written by a
+ *             single call of its callback. Only a value that is
+ *             longer than the buffer is written in parts and taken
+ *             again for each part, so callbacks must give the same
+ *             output when they are called again with the same
+ *             callback_state.
+ *
+ *             The putchar function of the context is not used, but
+ *             callbacks that call it write to the buffer.
+ */
+int jsontree_print_chunk(struct jsontree_context *js_ctx, char *buf,
+                         int size);
+
+/**
+ * \brief      Write the block of the output at an offset.
+ * \param js_ctx The context, set up with jsontree_setup()
+ * \param buf The buffer
+ * \param size The size of the block
+ * \param offset The offset of the block, set to the offset of the
+ *               next block, or to -1 after the last block
+ * \return The number of bytes written.
+ *
+ *             Follows the contract of the er-coap-07 resource
+ *             handlers, so that a handler can pass its buffer,
+ *             preferred_size and offset. A request for the block
+ *             after the previous one continues where that stopped.
+ *             Any other offset restarts the output and skips up to
+ *             the offset. Every block but the last is full, so a
+ *             value at the end of a block is taken again for the
+ *             next one, as for long values in jsontree_print_chunk().
+ */
+int jsontree_print_block(struct jsontree_context *js_ctx, char *buf,
+                         int size, int32_t *offset);
+
+/* Non-zero when all of the output has been written by
+   jsontree_print_chunk(). */
+#define jsontree_print_done(js_ctx) ((js_ctx)->done)
 struct jsontree_value *jsontree_find_next(struct jsontree_context *js_ctx,
                                           int type);
 
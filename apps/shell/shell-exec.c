@@ -77,6 +77,7 @@ PROCESS_THREAD(shell_exec_process, ev, data)
   } else {
     int ret;
     char *print, *symbol;
+    char buf[80];
 
     ret = elfloader_load(fd);
     cfs_close(fd);
@@ -115,6 +116,12 @@ PROCESS_THREAD(shell_exec_process, ev, data)
     }
     shell_output_str(&exec_command, print, symbol);
 
+    snprintf(buf, sizeof(buf), "%lu ms, %u reads, %u seeks, %u relocations",
+	     (unsigned long)elfloader_stats.time * 1000 / CLOCK_SECOND,
+	     elfloader_stats.reads, elfloader_stats.seeks,
+	     elfloader_stats.relocations);
+    shell_output_str(&exec_command, "exec: loaded in ", buf);
+
     if(ret == ELFLOADER_OK) {
       int i;
       for(i = 0; elfloader_autostart_processes[i] != NULL; ++i) {
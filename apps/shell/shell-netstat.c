@@ -39,6 +39,7 @@
 #include "contiki.h"
 #include "shell.h"
 #include "contiki-net.h"
+#include "net/mac/csma.h"
 
 static const char closed[] =   /*  "CLOSED",*/
 {0x43, 0x4c, 0x4f, 0x53, 0x45, 0x44, 0};
@@ -104,7 +105,7 @@ static const char *states[] = {
 PROCESS(shell_netstat_process, "netstat");
 SHELL_COMMAND(netstat_command,
 	      "netstat",
-	      "netstat: show UDP and TCP connections",
+	      "netstat: show UDP and TCP connections and CSMA queues",
 	      &shell_netstat_process);
 /*---------------------------------------------------------------------------*/
 PROCESS_THREAD(shell_netstat_process, ev, data)
@@ -112,6 +113,7 @@ PROCESS_THREAD(shell_netstat_process, ev, data)
   char buf[BUFLEN];
   int i;
   struct uip_conn *conn;
+  struct csma_queue_info info;
   PROCESS_BEGIN();
 
   for(i = 0; i < UIP_CONNS; ++i) {
@@ -131,6 +133,19 @@ PROCESS_THREAD(shell_netstat_process, ev, data)
 	     (uip_stopped(conn))? '!':' ');
     shell_output_str(&netstat_command, "TCP ", buf);
   }
+
+  snprintf(buf, BUFLEN,
+	   "%u enqueued, %u sent (%u in bursts), drops: %u quota, %u early, %u noack",
+	   csma_stats.enqueued, csma_stats.sent, csma_stats.sent_in_burst,
+	   csma_stats.drop_quota,
+	   csma_stats.drop_aqm, csma_stats.drop_noack);
+  shell_output_str(&netstat_command, "CSMA ", buf);
+  for(i = 0; csma_queue_info(i, &info); ++i) {
+    snprintf(buf, BUFLEN, "%u.%u, %u/%u packets, %u noacks",
+	     info.addr.u8[0], info.addr.u8[1],
+	     info.packets, info.quota, info.noacks);
+    shell_output_str(&netstat_command, "CSMA queue ", buf);
+  }
   PROCESS_END();
 }
 /*---------------------------------------------------------------------------*/
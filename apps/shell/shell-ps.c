@@ -65,9 +65,74 @@ PROCESS_THREAD(shell_ps_process, ev, data)
   PROCESS_END();
 }
 /*---------------------------------------------------------------------------*/
+#if PROCESS_ACCOUNTING
+PROCESS(shell_pstat_process, "pstat");
+SHELL_COMMAND(pstat_command,
+	      "pstat",
+	      "pstat [reset]: show the CPU time and event wait times of processes",
+	      &shell_pstat_process);
+
+/* The longest line: a name of 20 characters, 22 characters of text
+   and three unsigned longs of at most three digits per byte. */
+#define PSTAT_LINE_SIZE (20 + 22 + 3 * 3 * sizeof(unsigned long) + 1)
+/*---------------------------------------------------------------------------*/
+static unsigned long
+ticks_to_ms(unsigned long t)
+{
+  return t / RTIMER_SECOND * 1000 + (t % RTIMER_SECOND) * 1000 / RTIMER_SECOND;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+ticks_to_us(unsigned long t)
+{
+  unsigned long r;
+
+  /* Split up the multiplication so that it does not overflow. */
+  r = (t % RTIMER_SECOND) * 1000;
+  return t / RTIMER_SECOND * 1000000 + r / RTIMER_SECOND * 1000 +
+    (r % RTIMER_SECOND) * 1000 / RTIMER_SECOND;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(shell_pstat_process, ev, data)
+{
+  struct process *p;
+  char buf[PSTAT_LINE_SIZE];
+  int i, len;
+  PROCESS_BEGIN();
+
+  if(data != NULL && strcmp(data, "reset") == 0) {
+    process_accounting_reset();
+    PROCESS_EXIT();
+  }
+
+  sprintf(buf, "Event wait histogram bins of %lu us, doubling",
+	  ticks_to_us(PROCESS_ACCOUNTING_BIN_TICKS));
+  shell_output_str(&pstat_command, buf, "");
+  for(p = PROCESS_LIST(); p != NULL; p = p->next) {
+    sprintf(buf, "%.20s: %lu ms, %lu calls, max %lu us",
+	    PROCESS_NAME_STRING(p),
+	    ticks_to_ms(process_accounting_time(p)),
+	    process_accounting_invocations(p),
+	    ticks_to_us(process_accounting_max_time(p)));
+    shell_output_str(&pstat_command, buf, "");
+
+    len = sprintf(buf, "  wait");
+    for(i = 0; i < PROCESS_ACCOUNTING_BINS && len < (int)sizeof(buf) - 7; i++) {
+      len += sprintf(&buf[len], " %u", process_accounting_wait(p, i));
+    }
+    shell_output_str(&pstat_command, buf, "");
+  }
+
+  PROCESS_END();
+}
+#endif /* PROCESS_ACCOUNTING */
+/*---------------------------------------------------------------------------*/
 void
 shell_ps_init(void)
 {
   shell_register_command(&ps_command);
+#if PROCESS_ACCOUNTING
+  shell_register_command(&pstat_command);
+#endif /* PROCESS_ACCOUNTING */
 }
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Periodic draining of the trace to a collector over UDP.
+ *
+ *         Every TRACE_UDP_CONF_INTERVAL, the process sends the names
+ *         of the running processes, followed by as many datagrams of
+ *         trace records as it takes to empty the trace. The datagrams
+ *         are spaced out so that they do not fill the MAC queue.
+ */
+
+#include "contiki.h"
+#include "net/simple-udp.h"
+#include "sys/trace.h"
+#include "trace-udp.h"
+
+#include <string.h>
+
+#ifdef TRACE_UDP_CONF_INTERVAL
+#define INTERVAL TRACE_UDP_CONF_INTERVAL
+#else /* TRACE_UDP_CONF_INTERVAL */
+#define INTERVAL (10 * CLOCK_SECOND)
+#endif /* TRACE_UDP_CONF_INTERVAL */
+
+#ifdef TRACE_UDP_CONF_PAYLOAD
+#define PAYLOAD TRACE_UDP_CONF_PAYLOAD
+#else /* TRACE_UDP_CONF_PAYLOAD */
+#define PAYLOAD 80
+#endif /* TRACE_UDP_CONF_PAYLOAD */
+
+#define SPACING (CLOCK_SECOND / 8)
+
+static struct simple_udp_connection conn;
+static uip_ipaddr_t collector_addr;
+static uint8_t buf[PAYLOAD];
+
+PROCESS(trace_udp_process, "Trace over UDP");
+/*---------------------------------------------------------------------------*/
+static int
+describe_processes(void)
+{
+  static int first;
+  struct process *p;
+  int i, len;
+
+  /* Continue where the previous datagram ended, so that every process
+     is named eventually even if the names do not fit in one. */
+  len = 0;
+  i = 0;
+  for(p = PROCESS_LIST(); p != NULL; p = p->next, i++) {
+    if(i < first) {
+      continue;
+    }
+    if(len > 0 &&
+       len + 4 + strlen(PROCESS_NAME_STRING(p)) > sizeof(buf)) {
+      break;
+    }
+    len += trace_describe_process(&buf[len], sizeof(buf) - len, p);
+  }
+  first = p == NULL ? 0 : i;
+  return len;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(trace_udp_process, ev, data)
+{
+  static struct etimer periodic, spacing;
+  int len;
+
+  PROCESS_BEGIN();
+
+  simple_udp_register(&conn, TRACE_UDP_PORT, NULL, TRACE_UDP_PORT, NULL);
+
+  etimer_set(&periodic, INTERVAL);
+  while(1) {
+    PROCESS_WAIT_UNTIL(etimer_expired(&periodic));
+    etimer_reset(&periodic);
+
+    len = describe_processes();
+    if(len > 0) {
+      simple_udp_sendto(&conn, buf, len, &collector_addr);
+    }
+
+    while(trace_pending() > 0) {
+      etimer_set(&spacing, SPACING);
+      PROCESS_WAIT_UNTIL(etimer_expired(&spacing));
+      len = trace_drain(buf, sizeof(buf));
+      if(len > 0) {
+        simple_udp_sendto(&conn, buf, len, &collector_addr);
+      }
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+void
+trace_udp_init(const uip_ipaddr_t *collector)
+{
+  uip_ipaddr_copy(&collector_addr, collector);
+  process_start(&trace_udp_process, NULL);
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *	A tool for benchmarking Contiki software.
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+
+/* The samples of the benchmark that is being run. */
+static unsigned long ticks[BENCHMARK_REPETITIONS];
+static unsigned long cycles[BENCHMARK_REPETITIONS];
+/*---------------------------------------------------------------------------*/
+static void
+sort(unsigned long *samples, unsigned n)
+{
+  unsigned i, j;
+  unsigned long s;
+
+  /* Insertion sort is good enough for a few hundred samples and needs
+     no extra memory. */
+  for(i = 1; i < n; i++) {
+    s = samples[i];
+    for(j = i; j > 0 && samples[j - 1] > s; j--) {
+      samples[j] = samples[j - 1];
+    }
+    samples[j] = s;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+compute_stats(benchmark_stats_t *stats, unsigned long *samples, unsigned n)
+{
+  sort(samples, n);
+  stats->min = samples[0];
+  stats->median = samples[n / 2];
+  /* The nearest-rank percentile: the smallest sample that is at least
+     as large as 99% of the samples. */
+  stats->p99 = samples[(n * 99 + 99) / 100 - 1];
+  stats->max = samples[n - 1];
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Run a benchmark: a number of warm-up runs followed by
+ * BENCHMARK_REPETITIONS timed runs, and compute the statistics of
+ * the timed runs.
+ *
+ * \param bp The benchmark descriptor.
+ * \param function The benchmark function.
+ */
+void
+benchmark_run(benchmark_t *bp, void (*function)(benchmark_t *))
+{
+  unsigned i;
+
+  for(i = 0; i < BENCHMARK_WARMUP; i++) {
+    function(bp);
+  }
+
+  for(i = 0; i < BENCHMARK_REPETITIONS; i++) {
+    function(bp);
+    ticks[i] = bp->ticks_sample;
+    cycles[i] = bp->cycles_sample;
+  }
+
+  bp->repetitions = BENCHMARK_REPETITIONS;
+  compute_stats(&bp->ticks, ticks, BENCHMARK_REPETITIONS);
+  compute_stats(&bp->cycles, cycles, BENCHMARK_REPETITIONS);
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Print the results of a benchmark as a line of comma-separated
+ * values. A header line is printed before the first result.
+ *
+ * \param bp The benchmark descriptor.
+ */
+void
+benchmark_print_csv(const benchmark_t *bp)
+{
+  static unsigned char header_printed;
+
+  if(!header_printed) {
+    header_printed = 1;
+    printf("benchmark,ops,repetitions,ticks_per_second,"
+           "ticks_min,ticks_median,ticks_p99,ticks_max,"
+           "cycles_min,cycles_median,cycles_p99,cycles_max\n");
+  }
+  printf("%s,%u,%u,%lu,%lu,%lu,%lu,%lu,", bp->name, bp->ops,
+         bp->repetitions, (unsigned long)RTIMER_SECOND,
+         bp->ticks.min, bp->ticks.median, bp->ticks.p99, bp->ticks.max);
+  if(BENCHMARK_HAS_CYCLES) {
+    printf("%lu,%lu,%lu,%lu\n", bp->cycles.min, bp->cycles.median,
+           bp->cycles.p99, bp->cycles.max);
+  } else {
+    printf(",,,\n");
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Print the results of a benchmark as a JSON object on a line of its
+ * own.
+ *
+ * \param bp The benchmark descriptor.
+ */
+void
+benchmark_print_json(const benchmark_t *bp)
+{
+  printf("{\"benchmark\":\"%s\",\"description\":\"%s\","
+         "\"ops\":%u,\"repetitions\":%u,\"ticks_per_second\":%lu,",
+         bp->name, bp->descr, bp->ops, bp->repetitions,
+         (unsigned long)RTIMER_SECOND);
+  printf("\"ticks\":{\"min\":%lu,\"median\":%lu,\"p99\":%lu,\"max\":%lu}",
+         bp->ticks.min, bp->ticks.median, bp->ticks.p99, bp->ticks.max);
+  if(BENCHMARK_HAS_CYCLES) {
+    printf(",\"cycles\":{\"min\":%lu,\"median\":%lu,\"p99\":%lu,\"max\":%lu}",
+           bp->cycles.min, bp->cycles.median, bp->cycles.p99, bp->cycles.max);
+  }
+  printf("}\n");
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * Print a human-readable report of the results of a benchmark.
+ *
+ * \param bp The benchmark descriptor.
+ */
+void
+benchmark_print_report(const benchmark_t *bp)
+{
+  printf("\nBenchmark: %s\n", bp->descr);
+  printf("Operations: %u\n", bp->ops);
+  printf("Repetitions: %u\n", bp->repetitions);
+  printf("Ticks: min %lu median %lu p99 %lu max %lu\n",
+         bp->ticks.min, bp->ticks.median, bp->ticks.p99, bp->ticks.max);
+  printf("Ticks per second: %lu\n", (unsigned long)RTIMER_SECOND);
+  if(BENCHMARK_HAS_CYCLES) {
+    printf("Cycles: min %lu median %lu p99 %lu max %lu\n",
+           bp->cycles.min, bp->cycles.median, bp->cycles.p99, bp->cycles.max);
+    printf("Cycles per operation: %lu\n",
+           bp->ops > 0 ? bp->cycles.median / bp->ops : 0UL);
+  }
+}
+/*---------------------------------------------------------------------------*/
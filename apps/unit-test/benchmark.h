@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *	A tool for benchmarking Contiki software, built on the same
+ *	conventions as the unit test tool.
+ *
+ *	A benchmark runs its function a number of times after a few
+ *	warm-up runs, and reports the minimum, median, 99th percentile
+ *	and maximum duration of the timed section, both in rtimer
+ *	ticks and, where the CPU has a cycle counter, in CPU cycles.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "sys/rtimer.h"
+
+/* The number of timed runs of each benchmark. */
+#ifdef BENCHMARK_CONF_REPETITIONS
+#define BENCHMARK_REPETITIONS BENCHMARK_CONF_REPETITIONS
+#else /* BENCHMARK_CONF_REPETITIONS */
+#define BENCHMARK_REPETITIONS 101
+#endif /* BENCHMARK_CONF_REPETITIONS */
+
+/* The number of untimed runs before the timed ones, which fill the
+   caches and bring the code under test to a steady state. */
+#ifdef BENCHMARK_CONF_WARMUP
+#define BENCHMARK_WARMUP BENCHMARK_CONF_WARMUP
+#else /* BENCHMARK_CONF_WARMUP */
+#define BENCHMARK_WARMUP 5
+#endif /* BENCHMARK_CONF_WARMUP */
+
+/*
+ * The cycle counter is read with BENCHMARK_CONF_CYCLES(), which a
+ * platform or a project can define. When it is left undefined, the
+ * time stamp counter is used on x86 CPUs and the cycle columns are
+ * left empty elsewhere.
+ */
+#ifdef BENCHMARK_CONF_CYCLES
+#define BENCHMARK_CYCLES() BENCHMARK_CONF_CYCLES()
+#define BENCHMARK_HAS_CYCLES 1
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define BENCHMARK_CYCLES() benchmark_rdtsc()
+#define BENCHMARK_HAS_CYCLES 1
+static inline unsigned long
+benchmark_rdtsc(void)
+{
+  unsigned lo, hi;
+  __asm__ __volatile__("rdtsc" : "=a" (lo), "=d" (hi));
+  return ((unsigned long long)hi << 32) | lo;
+}
+#else
+#define BENCHMARK_CYCLES() 0UL
+#define BENCHMARK_HAS_CYCLES 0
+#endif
+
+/**
+ * The statistics of the samples of one benchmark.
+ */
+typedef struct benchmark_stats {
+  unsigned long min;
+  unsigned long median;
+  unsigned long p99;
+  unsigned long max;
+} benchmark_stats_t;
+
+/**
+ * The benchmark structure describes a benchmark and the statistics
+ * from its last execution. Each registered benchmark statically
+ * allocates an object of this type.
+ */
+typedef struct benchmark {
+  const char * const name;
+  const char * const descr;
+  /* The number of operations that one run of the timed section
+     performs, so that the results can be scaled to one operation. */
+  const unsigned ops;
+  unsigned repetitions;
+  rtimer_clock_t start;
+  unsigned long start_cycles;
+  unsigned long ticks_sample;
+  unsigned long cycles_sample;
+  benchmark_stats_t ticks;
+  benchmark_stats_t cycles;
+} benchmark_t;
+
+/**
+ * Register a benchmark.
+ *
+ * \param name The name of the benchmark, which is also the name
+ *             used in the machine-readable output.
+ * \param descr A string that briefly describes the benchmark.
+ * \param ops The number of operations in the timed section.
+ */
+#define BENCHMARK_REGISTER(name, descr, ops) static benchmark_t benchmark_##name = {#name, descr, ops}
+
+/**
+ * Define a benchmark.
+ *
+ * The function defined by this macro is called once per warm-up run
+ * and once per timed run. It may prepare its data first; only the
+ * code between BENCHMARK_BEGIN() and BENCHMARK_END() is timed.
+ *
+ * \param name The name of the benchmark.
+ */
+#define BENCHMARK(name) static void benchmark_function_##name(benchmark_t *bp)
+
+/**
+ * Mark the start of the timed section.
+ */
+#define BENCHMARK_BEGIN() do {                                                \
+                            bp->start = RTIMER_NOW();                         \
+                            bp->start_cycles = BENCHMARK_CYCLES();            \
+                          } while(0)
+
+/**
+ * Mark the end of the timed section.
+ */
+#define BENCHMARK_END() do {                                                  \
+                          bp->cycles_sample =                                 \
+                            BENCHMARK_CYCLES() - bp->start_cycles;            \
+                          bp->ticks_sample =                                  \
+                            (rtimer_clock_t)(RTIMER_NOW() - bp->start);       \
+                        } while(0)
+
+/**
+ * Repeat a statement once per operation of the benchmark.
+ *
+ * \param i An unsigned loop variable.
+ */
+#define BENCHMARK_LOOP(i) for((i) = 0; (i) < bp->ops; (i)++)
+
+/*
+ * The results are printed with a function that is selected by
+ * defining BENCHMARK_PRINT_FUNCTION, which must be of the type
+ * "void (*)(const benchmark_t *)". The default selection is
+ * benchmark_print_csv; benchmark_print_json and
+ * benchmark_print_report are also available in benchmark.c.
+ */
+#ifndef BENCHMARK_PRINT_FUNCTION
+#define BENCHMARK_PRINT_FUNCTION benchmark_print_csv
+#endif /* !BENCHMARK_PRINT_FUNCTION */
+
+/**
+ * Print the results of a benchmark.
+ *
+ * \param name The name of the benchmark.
+ */
+#define BENCHMARK_PRINT_REPORT(name) BENCHMARK_PRINT_FUNCTION(&benchmark_##name)
+
+/**
+ * Execute a benchmark and print its results.
+ *
+ * \param name The name of the benchmark.
+ */
+#define BENCHMARK_RUN(name) do {                                              \
+                              benchmark_run(&benchmark_##name,                \
+                                            benchmark_function_##name);       \
+                              BENCHMARK_PRINT_REPORT(name);                   \
+                            } while(0)
+
+/**
+ * Obtain the median duration of the last execution of a benchmark,
+ * in rtimer ticks.
+ *
+ * \param name The name of the benchmark.
+ */
+#define BENCHMARK_MEDIAN(name) (benchmark_##name.ticks.median)
+
+void benchmark_run(benchmark_t *bp, void (*function)(benchmark_t *));
+
+void benchmark_print_csv(const benchmark_t *bp);
+void benchmark_print_json(const benchmark_t *bp);
+void benchmark_print_report(const benchmark_t *bp);
+
+#endif /* !BENCHMARK_H */
@@ -145,7 +145,7 @@ PT_THREAD(file_stats(struct httpd_state *s, char *ptr))
 {
   PSOCK_BEGIN(&s->sout);
 
-  PSOCK_GENERATOR_SEND(&s->sout, generate_file_stats, (void *) (strchr(ptr, ' ') + 1));
+  HTTPD_CGI_GENERATOR_SEND(s, generate_file_stats, (void *) (strchr(ptr, ' ') + 1));
   
   PSOCK_END(&s->sout);
 }
@@ -195,7 +195,7 @@ PT_THREAD(tcp_stats(struct httpd_state *s, char *ptr))
 
   for(s->u.count = 0; s->u.count < UIP_CONNS; ++s->u.count) {
     if((uip_conns[s->u.count].tcpstateflags & UIP_TS_MASK) != UIP_CLOSED) {
-      PSOCK_GENERATOR_SEND(&s->sout, make_tcp_stats, s);
+      HTTPD_CGI_GENERATOR_SEND(s, make_tcp_stats, s);
     }
   }
 
@@ -222,7 +222,7 @@ PT_THREAD(processes(struct httpd_state *s, char *ptr))
 {
   PSOCK_BEGIN(&s->sout);
   for(s->u.ptr = PROCESS_LIST(); s->u.ptr != NULL; s->u.ptr = ((struct process *)s->u.ptr)->next) {
-    PSOCK_GENERATOR_SEND(&s->sout, make_processes, s->u.ptr);
+    HTTPD_CGI_GENERATOR_SEND(s, make_processes, s->u.ptr);
   }
   PSOCK_END(&s->sout);
 }
@@ -271,7 +271,7 @@ PT_THREAD(addresses(struct httpd_state *s, char *ptr))
 {
   PSOCK_BEGIN(&s->sout);
 
-  PSOCK_GENERATOR_SEND(&s->sout, make_addresses, s->u.ptr);
+  HTTPD_CGI_GENERATOR_SEND(s, make_addresses, s->u.ptr);
 
   PSOCK_END(&s->sout);
 }
@@ -299,7 +299,7 @@ PT_THREAD(neighbors(struct httpd_state *s, char *ptr))
 {
   PSOCK_BEGIN(&s->sout);
 
-  PSOCK_GENERATOR_SEND(&s->sout, make_neighbors, s->u.ptr);  
+  HTTPD_CGI_GENERATOR_SEND(s, make_neighbors, s->u.ptr);  
   
   PSOCK_END(&s->sout);
 }
@@ -338,7 +338,7 @@ PT_THREAD(routes(struct httpd_state *s, char *ptr))
 {
   PSOCK_BEGIN(&s->sout);
  
-  PSOCK_GENERATOR_SEND(&s->sout, make_routes, s->u.ptr); 
+  HTTPD_CGI_GENERATOR_SEND(s, make_routes, s->u.ptr); 
  
   PSOCK_END(&s->sout);
 }
@@ -52,5 +52,18 @@ void httpd_cgi_add(struct httpd_cgi_call *c);
 #define HTTPD_CGI_CALL(name, str, function) \
 static struct httpd_cgi_call name = {NULL, str, function}
 
+/* The output of a script must be sent with these macros instead of
+   the PSOCK ones, so that it can be sent with chunked encoding on a
+   persistent connection. A string must fit in one segment. */
+#define HTTPD_CGI_GENERATOR_SEND(s, gen, arg)			\
+  do {								\
+    (s)->generator = (gen);					\
+    (s)->generator_arg = (arg);					\
+    PSOCK_GENERATOR_SEND(&(s)->sout, httpd_generate, (s));	\
+  } while(0)
+
+#define HTTPD_CGI_SEND_STR(s, str)				\
+  HTTPD_CGI_GENERATOR_SEND(s, httpd_generate_str, (void *)(str))
+
 void httpd_cgi_init(void);
 #endif /* __HTTPD_CGI_H__ */
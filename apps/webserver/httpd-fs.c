@@ -37,13 +37,52 @@
 #include "httpd-fs.h"
 #include "httpd-fsdata.h"
 
+#include <string.h>
+
 #include "httpd-fsdata.c"
 
+#ifdef HTTPD_FS_HASH_SIZE
+/* makefsdata -H has generated a hashed index of the files, so a file
+   is usually found with a single probe. */
+#define NUMSLOTS HTTPD_FS_HASH_SIZE
+#else
+#define NUMSLOTS HTTPD_FS_NUMFILES
+#endif
+
 #if HTTPD_FS_STATISTICS
-static uint16_t count[HTTPD_FS_NUMFILES];
+static uint16_t count[NUMSLOTS];
 #endif /* HTTPD_FS_STATISTICS */
 
 /*-----------------------------------------------------------------------------------*/
+#ifdef HTTPD_FS_HASH_SIZE
+/* Returns the slot of a file in the hashed index, or -1. The name ends
+   at a NUL, a newline or the start of a query string. */
+static int
+lookup(const char *name, struct httpd_fsdata_file_noconst **file)
+{
+  const char *end;
+  struct httpd_fsdata_file_noconst *f;
+  uint16_t h;
+  int i;
+
+  h = 0;
+  for(end = name;
+      *end != 0 && *end != '\r' && *end != '\n' && *end != '?';
+      end++) {
+    h = h * HTTPD_FS_HASH_MULT + (uint8_t)*end;
+  }
+
+  for(i = h & (HTTPD_FS_HASH_SIZE - 1);
+      (f = (struct httpd_fsdata_file_noconst *)httpd_fs_hash[i]) != NULL;
+      i = (i + 1) & (HTTPD_FS_HASH_SIZE - 1)) {
+    if(strncmp(f->name, name, end - name) == 0 && f->name[end - name] == 0) {
+      *file = f;
+      return i;
+    }
+  }
+  return -1;
+}
+#else /* HTTPD_FS_HASH_SIZE */
 static uint8_t
 httpd_fs_strcmp(const char *str1, const char *str2)
 {
@@ -65,32 +104,52 @@ loop:
   goto loop;
 }
 /*-----------------------------------------------------------------------------------*/
-int
-httpd_fs_open(const char *name, struct httpd_fs_file *file)
+static int
+lookup(const char *name, struct httpd_fsdata_file_noconst **file)
 {
-#if HTTPD_FS_STATISTICS
-  uint16_t i = 0;
-#endif /* HTTPD_FS_STATISTICS */
   struct httpd_fsdata_file_noconst *f;
+  int i;
 
+  i = 0;
   for(f = (struct httpd_fsdata_file_noconst *)HTTPD_FS_ROOT;
       f != NULL;
       f = (struct httpd_fsdata_file_noconst *)f->next) {
-
     if(httpd_fs_strcmp(name, f->name) == 0) {
-      file->data = f->data;
-      file->len = f->len;
-#if HTTPD_FS_STATISTICS
-      ++count[i];
-#endif /* HTTPD_FS_STATISTICS */
-      return 1;
+      *file = f;
+      return i;
     }
-#if HTTPD_FS_STATISTICS
     ++i;
-#endif /* HTTPD_FS_STATISTICS */
+  }
+  return -1;
+}
+#endif /* HTTPD_FS_HASH_SIZE */
+/*-----------------------------------------------------------------------------------*/
+int
+httpd_fs_open(const char *name, struct httpd_fs_file *file)
+{
+  struct httpd_fsdata_file_noconst *f;
+  int i;
 
+  i = lookup(name, &f);
+  if(i < 0) {
+    return 0;
+  }
+  if(file->gzip && f->gzdata != NULL) {
+    file->data = f->gzdata;
+    file->len = f->gzlen;
+    file->header = f->gzheader;
+    file->etag = f->gzetag;
+  } else {
+    file->data = f->data;
+    file->len = f->len;
+    file->header = f->header;
+    file->etag = f->etag;
+    file->gzip = 0;
   }
-  return 0;
+#if HTTPD_FS_STATISTICS
+  ++count[i];
+#endif /* HTTPD_FS_STATISTICS */
+  return 1;
 }
 /*-----------------------------------------------------------------------------------*/
 void
@@ -98,7 +157,7 @@ httpd_fs_init(void)
 {
 #if HTTPD_FS_STATISTICS
   uint16_t i;
-  for(i = 0; i < HTTPD_FS_NUMFILES; i++) {
+  for(i = 0; i < NUMSLOTS; i++) {
     count[i] = 0;
   }
 #endif /* HTTPD_FS_STATISTICS */
@@ -109,19 +168,10 @@ uint16_t
 httpd_fs_count(char *name)
 {
   struct httpd_fsdata_file_noconst *f;
-  uint16_t i;
-
-  i = 0;
-  for(f = (struct httpd_fsdata_file_noconst *)HTTPD_FS_ROOT;
-      f != NULL;
-      f = (struct httpd_fsdata_file_noconst *)f->next) {
+  int i;
 
-    if(httpd_fs_strcmp(name, f->name) == 0) {
-      return count[i];
-    }
-    ++i;
-  }
-  return 0;
+  i = lookup(name, &f);
+  return i < 0 ? 0 : count[i];
 }
 #endif /* HTTPD_FS_STATISTICS */
 /*-----------------------------------------------------------------------------------*/
@@ -41,6 +41,14 @@
 struct httpd_fs_file {
   char *data;
   int len;
+  /* The precomputed HTTP headers of the file, or NULL if they have to
+     be made up from the file name. */
+  const char *header;
+  /* The ETag of the file data, or NULL. */
+  const char *etag;
+  /* Set by the caller if the client accepts gzip encoding. Cleared
+     by httpd_fs_open() if the file has no compressed variant. */
+  char gzip;
 };
 
 /* file must be allocated by caller and will be filled in
@@ -41,6 +41,18 @@ struct httpd_fsdata_file {
   const char *name;
   const char *data;
   const int len;
+  /* The HTTP headers of the file, precomputed by makefsdata -H, or
+     NULL. */
+  const char *header;
+  /* The ETag of the file, or NULL if the page has server side
+     includes. */
+  const char *etag;
+  /* The gzip compressed variant of the file, added by makefsdata -z,
+     with its own headers and ETag. NULL if there is none. */
+  const char *gzdata;
+  const int gzlen;
+  const char *gzheader;
+  const char *gzetag;
 #ifdef HTTPD_FS_STATISTICS
 #if HTTPD_FS_STATISTICS == 1
   uint16_t count;
@@ -53,6 +65,12 @@ struct httpd_fsdata_file_noconst {
   char *name;
   char *data;
   int len;
+  char *header;
+  char *etag;
+  char *gzdata;
+  int gzlen;
+  char *gzheader;
+  char *gzetag;
 #ifdef HTTPD_FS_STATISTICS
 #if HTTPD_FS_STATISTICS == 1
   uint16_t count;
@@ -51,33 +51,101 @@
 #define CONNS WEBSERVER_CONF_CGI_CONNS
 #endif /* WEBSERVER_CONF_CGI_CONNS */
 
+#ifdef WEBSERVER_CONF_KEEPALIVE_TIMEOUT
+#define KEEPALIVE_TIMEOUT WEBSERVER_CONF_KEEPALIVE_TIMEOUT
+#else /* WEBSERVER_CONF_KEEPALIVE_TIMEOUT */
+/* In periodic TCP polls, which come twice a second. */
+#define KEEPALIVE_TIMEOUT 10
+#endif /* WEBSERVER_CONF_KEEPALIVE_TIMEOUT */
+
 #define STATE_WAITING 0
 #define STATE_OUTPUT  1
+#define STATE_CLOSING 2
+
+#define FLAG_GZIP      0x01
+#define FLAG_KEEPALIVE 0x02
+#define FLAG_CHUNKED   0x04
+#define FLAG_OVERFLOW  0x08
+
+/* Four hex digits and CRLF. */
+#define CHUNK_HEADER_LEN 6
 
 #define SEND_STRING(s, str) PSOCK_SEND(s, (uint8_t *)str, (unsigned int)strlen(str))
 MEMB(conns, struct httpd_state, CONNS);
 
 #define ISO_nl      0x0a
+#define ISO_cr      0x0d
 #define ISO_space   0x20
 #define ISO_bang    0x21
+#define ISO_quote   0x22
 #define ISO_percent 0x25
 #define ISO_period  0x2e
 #define ISO_slash   0x2f
 #define ISO_colon   0x3a
 
+/*---------------------------------------------------------------------------*/
+unsigned short
+httpd_generate(void *state)
+{
+  static const char hex[] = "0123456789abcdef";
+  struct httpd_state *s = (struct httpd_state *)state;
+  char *buf = (char *)uip_appdata;
+  uint16_t mss;
+  unsigned short len;
+  int i;
+
+  if(!(s->flags & FLAG_CHUNKED)) {
+    return s->generator(s->generator_arg);
+  }
+
+  /* Let the generator fill the segment less the room needed for the
+     chunk size line in front of its output and the CRLF after it. */
+  mss = uip_conn->mss;
+  uip_conn->mss -= CHUNK_HEADER_LEN + 2;
+  len = s->generator(s->generator_arg);
+  uip_conn->mss = mss;
+  if(len > mss - CHUNK_HEADER_LEN - 2) {
+    len = mss - CHUNK_HEADER_LEN - 2;
+  }
+
+  /* An empty chunk would end the body. */
+  if(len == 0) {
+    return 0;
+  }
+
+  memmove(buf + CHUNK_HEADER_LEN, buf, len);
+  for(i = 0; i < CHUNK_HEADER_LEN - 2; i++) {
+    buf[i] = hex[(len >> (4 * (CHUNK_HEADER_LEN - 3 - i))) & 0xf];
+  }
+  buf[CHUNK_HEADER_LEN - 2] = ISO_cr;
+  buf[CHUNK_HEADER_LEN - 1] = ISO_nl;
+  buf[CHUNK_HEADER_LEN + len] = ISO_cr;
+  buf[CHUNK_HEADER_LEN + len + 1] = ISO_nl;
+  return CHUNK_HEADER_LEN + len + 2;
+}
+/*---------------------------------------------------------------------------*/
+unsigned short
+httpd_generate_str(void *str)
+{
+  unsigned short len;
+
+  len = strlen((char *)str);
+  if(len > uip_mss()) {
+    len = uip_mss();
+  }
+  memcpy(uip_appdata, str, len);
+  return len;
+}
 /*---------------------------------------------------------------------------*/
 static unsigned short
-generate(void *state)
+generate_part(void *state)
 {
   struct httpd_state *s = (struct httpd_state *)state;
 
-  if(s->file.len > uip_mss()) {
+  if(s->len > uip_mss()) {
     s->len = uip_mss();
-  } else {
-    s->len = s->file.len;
   }
   memcpy(uip_appdata, s->file.data, s->len);
-  
   return s->len;
 }
 /*---------------------------------------------------------------------------*/
@@ -85,13 +153,23 @@ static
 PT_THREAD(send_file(struct httpd_state *s))
 {
   PSOCK_BEGIN(&s->sout);
-  
-  do {
-    PSOCK_GENERATOR_SEND(&s->sout, generate, s);
-    s->file.len -= s->len;
-    s->file.data += s->len;
-  } while(s->file.len > 0);
-      
+
+  if(s->flags & FLAG_CHUNKED) {
+    while(s->file.len > 0) {
+      s->len = s->file.len;
+      HTTPD_CGI_GENERATOR_SEND(s, generate_part, s);
+      s->file.data += s->len;
+      s->file.len -= s->len;
+    }
+  } else {
+    /* The file is sent directly from the file system: psock splits it
+       into segments and retransmits from the file data, so it is never
+       copied anywhere but into the packet buffer. */
+    PSOCK_SEND(&s->sout, (uint8_t *)s->file.data, s->file.len);
+    s->file.data += s->file.len;
+    s->file.len = 0;
+  }
+
   PSOCK_END(&s->sout);
 }
 /*---------------------------------------------------------------------------*/
@@ -100,7 +178,11 @@ PT_THREAD(send_part_of_file(struct httpd_state *s))
 {
   PSOCK_BEGIN(&s->sout);
 
-  PSOCK_SEND(&s->sout, (uint8_t *)s->file.data, s->len);
+  if(s->flags & FLAG_CHUNKED) {
+    HTTPD_CGI_GENERATOR_SEND(s, generate_part, s);
+  } else {
+    PSOCK_SEND(&s->sout, (uint8_t *)s->file.data, s->len);
+  }
   
   PSOCK_END(&s->sout);
 }
@@ -123,6 +205,20 @@ next_scriptstate(struct httpd_state *s)
   s->scriptptr = p;*/
 }
 /*---------------------------------------------------------------------------*/
+static void
+include_name(struct httpd_state *s)
+{
+  int i;
+
+  /* The file data is not NUL terminated, so the name of an included
+     file is copied out up to the end of its line. */
+  for(i = 0; i < s->scriptlen - 1 && i < (int)sizeof(s->filename) - 1 &&
+	s->scriptptr[i + 1] != ISO_cr && s->scriptptr[i + 1] != ISO_nl; i++) {
+    s->filename[i] = s->scriptptr[i + 1];
+  }
+  s->filename[i] = 0;
+}
+/*---------------------------------------------------------------------------*/
 static
 PT_THREAD(handle_script(struct httpd_state *s))
 {
@@ -138,8 +234,11 @@ PT_THREAD(handle_script(struct httpd_state *s))
       s->scriptptr = s->file.data + 3;
       s->scriptlen = s->file.len - 3;
       if(*(s->scriptptr - 1) == ISO_colon) {
-	httpd_fs_open(s->scriptptr + 1, &s->file);
-	PT_WAIT_THREAD(&s->scriptpt, send_file(s));
+	include_name(s);
+	s->file.gzip = 0;
+	if(httpd_fs_open(s->filename, &s->file)) {
+	  PT_WAIT_THREAD(&s->scriptpt, send_file(s));
+	}
       } else {
 	PT_WAIT_THREAD(&s->scriptpt,
 		       httpd_cgi(s->scriptptr)(s, s->scriptptr));
@@ -181,106 +280,295 @@ PT_THREAD(handle_script(struct httpd_state *s))
   PT_END(&s->scriptpt);
 }
 /*---------------------------------------------------------------------------*/
-static
-PT_THREAD(send_headers(struct httpd_state *s, const char *statushdr))
+static const char *
+content_type(struct httpd_state *s)
 {
-/* gcc warning if not initialized. 
- * If initialized, minimal-net platform segmentation fault if not static...
- */
-  static const char *ptr = NULL;
-
-  PSOCK_BEGIN(&s->sout);
+  const char *ptr;
 
-  SEND_STRING(&s->sout, statushdr);
+  /* Files generated with makefsdata -H carry their own headers. */
+  if(s->file.header != NULL) {
+    return s->file.header;
+  }
 
   ptr = strrchr(s->filename, ISO_period);
   if(ptr == NULL) {
-    ptr = http_content_type_binary;
+    return http_content_type_binary;
   } else if(strncmp(http_html, ptr, 5) == 0 ||
 	    strncmp(http_shtml, ptr, 6) == 0) {
-    ptr = http_content_type_html;
+    return http_content_type_html;
   } else if(strncmp(http_css, ptr, 4) == 0) {
-    ptr = http_content_type_css;
+    return http_content_type_css;
   } else if(strncmp(http_png, ptr, 4) == 0) {
-    ptr = http_content_type_png;
+    return http_content_type_png;
   } else if(strncmp(http_gif, ptr, 4) == 0) {
-    ptr = http_content_type_gif;
+    return http_content_type_gif;
   } else if(strncmp(http_jpg, ptr, 4) == 0) {
-    ptr = http_content_type_jpg;
+    return http_content_type_jpg;
+  }
+  return http_content_type_plain;
+}
+/*---------------------------------------------------------------------------*/
+static int
+is_script(struct httpd_state *s)
+{
+  const char *ptr;
+
+  ptr = strrchr(s->filename, ISO_period);
+  return ptr != NULL && strncmp(ptr, http_shtml, 6) == 0;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+generate_headers(void *state)
+{
+  struct httpd_state *s = (struct httpd_state *)state;
+  const char *type;
+  unsigned short len, typelen;
+
+  /* The status line, the headers and, for static files, the start of
+     the file go out in one segment. This function is called again for
+     retransmissions, so it must produce the same data every time. */
+  type = content_type(s);
+  len = strlen(s->statushdr);
+  typelen = strlen(type);
+  memcpy(uip_appdata, s->statushdr, len);
+  if(s->flags & FLAG_CHUNKED) {
+    memcpy((char *)uip_appdata + len, http_chunked, sizeof(http_chunked) - 1);
+    len += sizeof(http_chunked) - 1;
+  }
+  memcpy((char *)uip_appdata + len, type, typelen);
+  len += typelen;
+
+  s->len = 0;
+  if(!is_script(s)) {
+    s->len = uip_mss() - len;
+    if(s->len > s->file.len) {
+      s->len = s->file.len;
+    }
+    memcpy((char *)uip_appdata + len, s->file.data, s->len);
+  }
+  return len + s->len;
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(send_headers(struct httpd_state *s))
+{
+  PSOCK_BEGIN(&s->sout);
+
+  if(strlen(s->statushdr) + sizeof(http_chunked) +
+     strlen(content_type(s)) <= uip_mss()) {
+    PSOCK_GENERATOR_SEND(&s->sout, generate_headers, s);
+    s->file.data += s->len;
+    s->file.len -= s->len;
   } else {
-    ptr = http_content_type_plain;
+    SEND_STRING(&s->sout, s->statushdr);
+    if(s->flags & FLAG_CHUNKED) {
+      SEND_STRING(&s->sout, http_chunked);
+    }
+    SEND_STRING(&s->sout, content_type(s));
   }
-  SEND_STRING(&s->sout, ptr);
+
+  PSOCK_END(&s->sout);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+generate_not_modified(void *state)
+{
+  struct httpd_state *s = (struct httpd_state *)state;
+
+  return sprintf((char *)uip_appdata, "%s%s\"%s\"\r\n\r\n",
+		 s->statushdr, http_etag, s->file.etag);
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(send_not_modified(struct httpd_state *s))
+{
+  PSOCK_BEGIN(&s->sout);
+  PSOCK_GENERATOR_SEND(&s->sout, generate_not_modified, s);
+  PSOCK_END(&s->sout);
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(send_last_chunk(struct httpd_state *s))
+{
+  PSOCK_BEGIN(&s->sout);
+  SEND_STRING(&s->sout, http_last_chunk);
   PSOCK_END(&s->sout);
 }
 /*---------------------------------------------------------------------------*/
 static
 PT_THREAD(handle_output(struct httpd_state *s))
 {
-  char *ptr;
-  
+  int status;
+
   PT_BEGIN(&s->outputpt);
  
+  s->file.header = NULL;
+  s->file.etag = NULL;
   if(!httpd_fs_open(s->filename, &s->file)) {
     strcpy(s->filename, http_404_html);
     httpd_fs_open(s->filename, &s->file);
+    status = 404;
+  } else if(s->file.etag != NULL && strcmp(s->etag, s->file.etag) == 0) {
+    /* The client already has this version of the file. */
+    status = 304;
+  } else {
+    status = 200;
+  }
+
+  /* The connection can only be kept open if the client can tell where
+     the response ends: from the precomputed Content-Length of a static
+     file, or from the chunked encoding of the output of a script. */
+  if(is_script(s)) {
+    if(s->flags & FLAG_KEEPALIVE) {
+      s->flags |= FLAG_CHUNKED;
+    }
+  } else if(s->file.header == NULL) {
+    s->flags &= ~FLAG_KEEPALIVE;
+  }
+
+  if(s->flags & FLAG_KEEPALIVE) {
+    s->statushdr = status == 404 ? http_header11_404 :
+      status == 304 ? http_header11_304 : http_header11_200;
+  } else {
+    s->statushdr = status == 404 ? http_header_404 :
+      status == 304 ? http_header_304 : http_header_200;
+  }
+
+  if(status == 304) {
     PT_WAIT_THREAD(&s->outputpt,
-		   send_headers(s,
-		   http_header_404));
-    PT_WAIT_THREAD(&s->outputpt,
-		   send_file(s));
+		   send_not_modified(s));
   } else {
     PT_WAIT_THREAD(&s->outputpt,
-		   send_headers(s,
-		   http_header_200));
-    ptr = strrchr(s->filename, ISO_period);
-    if(ptr != NULL && strncmp(ptr, http_shtml, 6) == 0) {
+		   send_headers(s));
+    if(is_script(s)) {
       PT_INIT(&s->scriptpt);
       PT_WAIT_THREAD(&s->outputpt, handle_script(s));
+      if(s->flags & FLAG_CHUNKED) {
+	PT_WAIT_THREAD(&s->outputpt, send_last_chunk(s));
+      }
     } else {
       PT_WAIT_THREAD(&s->outputpt,
 		     send_file(s));
     }
   }
-  PSOCK_CLOSE(&s->sout);
+
+  if(s->flags & FLAG_KEEPALIVE) {
+    s->state = STATE_WAITING;
+  } else {
+    s->state = STATE_CLOSING;
+    PSOCK_CLOSE(&s->sout);
+  }
   PT_END(&s->outputpt);
 }
 /*---------------------------------------------------------------------------*/
+static void
+next_request(struct httpd_state *s)
+{
+  struct httpd_request *r;
+
+  r = &s->request[s->first];
+  memcpy(s->filename, r->filename, sizeof(s->filename));
+  memcpy(s->etag, r->etag, sizeof(s->etag));
+  s->file.gzip = (r->flags & FLAG_GZIP) != 0;
+  s->flags = (s->flags & FLAG_OVERFLOW) | (r->flags & FLAG_KEEPALIVE);
+  s->first = (s->first + 1) % HTTPD_PIPELINE;
+  s->requests--;
+
+  /* Close the connection after the last request that was queued
+     before the queue overflowed. */
+  if((s->flags & FLAG_OVERFLOW) && s->requests == 0) {
+    s->flags &= ~FLAG_KEEPALIVE;
+  }
+
+  PT_INIT(&s->outputpt);
+  s->state = STATE_OUTPUT;
+}
+/*---------------------------------------------------------------------------*/
 static
 PT_THREAD(handle_input(struct httpd_state *s))
 {
+  struct httpd_request *r;
+  char *ptr;
+
   PSOCK_BEGIN(&s->sin);
 
-  PSOCK_READTO(&s->sin, ISO_space);
+  while(1) {
+    PSOCK_READTO(&s->sin, ISO_space);
   
-  if(strncmp(s->inputbuf, http_get, 4) != 0) {
-    PSOCK_CLOSE_EXIT(&s->sin);
-  }
-  PSOCK_READTO(&s->sin, ISO_space);
+    if(strncmp(s->inputbuf, http_get, 4) != 0) {
+      s->state = STATE_CLOSING;
+      PSOCK_CLOSE_EXIT(&s->sin);
+    }
 
-  if(s->inputbuf[0] != ISO_slash) {
-    PSOCK_CLOSE_EXIT(&s->sin);
-  }
+    /* Requests that are pipelined behind a full queue are not
+       answered. The connection is closed once the queued requests
+       have been served, and the client sends the others again. */
+    if(s->requests == HTTPD_PIPELINE) {
+      s->flags |= FLAG_OVERFLOW;
+      PSOCK_EXIT(&s->sin);
+    }
 
-  if(s->inputbuf[1] == ISO_space) {
-    strncpy(s->filename, http_index_html, sizeof(s->filename));
-  } else {
-    s->inputbuf[PSOCK_DATALEN(&s->sin) - 1] = 0;
-    strncpy(s->filename, s->inputbuf, sizeof(s->filename));
-  }
+    PSOCK_READTO(&s->sin, ISO_space);
+    r = &s->request[(s->first + s->requests) % HTTPD_PIPELINE];
 
-  petsciiconv_topetscii(s->filename, sizeof(s->filename));
-  webserver_log_file(&uip_conn->ripaddr, s->filename);
-  petsciiconv_toascii(s->filename, sizeof(s->filename));
-  s->state = STATE_OUTPUT;
+    if(s->inputbuf[0] != ISO_slash) {
+      s->state = STATE_CLOSING;
+      PSOCK_CLOSE_EXIT(&s->sin);
+    }
 
-  while(1) {
+    if(s->inputbuf[1] == ISO_space) {
+      strncpy(r->filename, http_index_html, sizeof(r->filename));
+    } else {
+      s->inputbuf[PSOCK_DATALEN(&s->sin) - 1] = 0;
+      strncpy(r->filename, s->inputbuf, sizeof(r->filename));
+    }
+    r->filename[sizeof(r->filename) - 1] = 0;
+
+    petsciiconv_topetscii(r->filename, sizeof(r->filename));
+    webserver_log_file(&uip_conn->ripaddr, r->filename);
+    petsciiconv_toascii(r->filename, sizeof(r->filename));
+    r->etag[0] = 0;
+
+    /* HTTP/1.1 connections are persistent unless the client asks for
+       them to be closed. */
     PSOCK_READTO(&s->sin, ISO_nl);
+    r = &s->request[(s->first + s->requests) % HTTPD_PIPELINE];
+    r->flags = strncmp(s->inputbuf, http_11, 8) == 0 ? FLAG_KEEPALIVE : 0;
+
+    while(1) {
+      PSOCK_READTO(&s->sin, ISO_nl);
+      s->inputbuf[PSOCK_DATALEN(&s->sin)] = 0;
+      r = &s->request[(s->first + s->requests) % HTTPD_PIPELINE];
 
-    if(strncmp(s->inputbuf, http_referer, 8) == 0) {
-      s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
-      petsciiconv_topetscii(s->inputbuf, PSOCK_DATALEN(&s->sin) - 2);
-      webserver_log(s->inputbuf);
+      /* The response depends on the request headers, so it is not
+	 queued until the empty line that ends them. */
+      if(s->inputbuf[0] == ISO_cr || s->inputbuf[0] == ISO_nl) {
+	s->requests++;
+	if(s->state == STATE_WAITING) {
+	  next_request(s);
+	}
+	break;
+      } else if(strncmp(s->inputbuf, http_referer, 8) == 0) {
+	s->inputbuf[PSOCK_DATALEN(&s->sin) - 2] = 0;
+	petsciiconv_topetscii(s->inputbuf, PSOCK_DATALEN(&s->sin) - 2);
+	webserver_log(s->inputbuf);
+      } else if(strncmp(s->inputbuf, http_connection, 11) == 0) {
+	if(strstr(s->inputbuf + 11, http_close) != NULL) {
+	  r->flags &= ~FLAG_KEEPALIVE;
+	}
+      } else if(strncmp(s->inputbuf, http_accept_encoding, 16) == 0) {
+	if(strstr(s->inputbuf + 16, http_gzip) != NULL) {
+	  r->flags |= FLAG_GZIP;
+	}
+      } else if(strncmp(s->inputbuf, http_if_none_match, 14) == 0) {
+	/* Only the first ETag of the list is compared. */
+	ptr = strchr(s->inputbuf + 14, ISO_quote);
+	if(ptr != NULL && strlen(ptr) > sizeof(r->etag) &&
+	   ptr[sizeof(r->etag)] == ISO_quote) {
+	  memcpy(r->etag, ptr + 1, sizeof(r->etag) - 1);
+	  r->etag[sizeof(r->etag) - 1] = 0;
+	}
+      }
     }
   }
   
@@ -290,9 +578,23 @@ PT_THREAD(handle_input(struct httpd_state *s))
 static void
 handle_connection(struct httpd_state *s)
 {
-  handle_input(s);
-  if(s->state == STATE_OUTPUT) {
+  if(s->state != STATE_CLOSING && !(s->flags & FLAG_OVERFLOW)) {
+    handle_input(s);
+  }
+
+  /* Pipelined requests are served in order. The next response starts
+     as soon as the previous one has been acknowledged. */
+  while(s->state != STATE_CLOSING) {
+    if(s->state == STATE_WAITING) {
+      if(s->requests == 0) {
+	break;
+      }
+      next_request(s);
+    }
     handle_output(s);
+    if(s->state == STATE_OUTPUT) {
+      break;
+    }
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -316,6 +618,9 @@ httpd_appcall(void *state)
     PSOCK_INIT(&s->sout, (uint8_t *)s->inputbuf, sizeof(s->inputbuf) - 1);
     PT_INIT(&s->outputpt);
     s->state = STATE_WAITING;
+    s->flags = 0;
+    s->first = 0;
+    s->requests = 0;
     /*    timer_set(&s->timer, CLOCK_SECOND * 100);*/
     s->timer = 0;
     handle_connection(s);
@@ -325,6 +630,13 @@ httpd_appcall(void *state)
       if(s->timer >= 20) {
 	uip_abort();
 	memb_free(&conns, s);
+	return;
+      }
+      /* Close a persistent connection that has been idle too long. */
+      if(s->timer >= KEEPALIVE_TIMEOUT &&
+	 s->state == STATE_WAITING && s->requests == 0) {
+	s->state = STATE_CLOSING;
+	uip_close();
       }
     } else {
       s->timer = 0;
@@ -38,17 +38,36 @@
 #include "contiki-net.h"
 #include "httpd-fs.h"
 
+#ifdef WEBSERVER_CONF_PIPELINE
+#define HTTPD_PIPELINE WEBSERVER_CONF_PIPELINE
+#else /* WEBSERVER_CONF_PIPELINE */
+#define HTTPD_PIPELINE 2
+#endif /* WEBSERVER_CONF_PIPELINE */
+
+struct httpd_request {
+  char filename[20];
+  char etag[9];
+  char flags;
+};
+
 struct httpd_state {
   unsigned char timer;
   struct psock sin, sout;
   struct pt outputpt, scriptpt;
   char inputbuf[50];
   char filename[20];
+  char etag[9];
   char state;
+  char flags;
   struct httpd_fs_file file;  
   int len;
+  const char *statushdr;
   char *scriptptr;
   int scriptlen;
+  unsigned short (* generator)(void *);
+  void *generator_arg;
+  struct httpd_request request[HTTPD_PIPELINE];
+  unsigned char first, requests;
   union {
     unsigned short count;
     void *ptr;
@@ -59,6 +78,12 @@ struct httpd_state {
 void httpd_init(void);
 void httpd_appcall(void *state);
 
+/* Generator for PSOCK_GENERATOR_SEND() that calls s->generator and
+   frames its output as a chunk when the response is chunked. Scripts
+   send through it with the HTTPD_CGI_ macros in httpd-cgi.h. */
+unsigned short httpd_generate(void *state);
+unsigned short httpd_generate_str(void *str);
+
 #if UIP_CONF_IPV6
 uint8_t httpd_sprint_ip6(uip_ip6addr_t addr, char * result);
 #endif /* UIP_CONF_IPV6 */
@@ -64,6 +64,20 @@
 #define CC2420_CONF_AUTOACK 0
 #endif /* CC2420_CONF_AUTOACK */
 
+/* The number of frames in the RX ring, a power of two. With an RX
+   ring, frames are moved out of the RX FIFO by the FIFOP interrupt
+   so that the FIFO does not overflow while the upper layers are
+   busy. */
+#ifdef CC2420_CONF_RX_RING
+#define CC2420_RX_RING CC2420_CONF_RX_RING
+#else
+#define CC2420_RX_RING 0
+#endif /* CC2420_CONF_RX_RING */
+
+#if CC2420_RX_RING
+#include "dev/radio-ring.h"
+#endif /* CC2420_RX_RING */
+
 #if CC2420_CONF_CHECKSUM
 #include "lib/crc16.h"
 #define CHECKSUM_LEN 2
@@ -119,6 +133,10 @@ volatile uint16_t cc2420_sfd_start_time;
 volatile uint16_t cc2420_sfd_end_time;
 
 static volatile uint16_t last_packet_timestamp;
+
+#if CC2420_RX_RING
+RADIO_RING(rx_ring, CC2420_RX_RING);
+#endif /* CC2420_RX_RING */
 /*---------------------------------------------------------------------------*/
 PROCESS(cc2420_process, "CC2420 driver");
 /*---------------------------------------------------------------------------*/
@@ -242,6 +260,11 @@ static void RELEASE_LOCK(void) {
   }
   locked--;
 }
+#ifdef CC2420_SPI_IS_ENABLED
+#define SPI_IS_BUSY() (locked || CC2420_SPI_IS_ENABLED())
+#else
+#define SPI_IS_BUSY() locked
+#endif /* CC2420_SPI_IS_ENABLED */
 /*---------------------------------------------------------------------------*/
 static unsigned
 getreg(enum cc2420_register regname)
@@ -602,25 +625,112 @@ cc2420_set_pan_addr(unsigned pan,
   RELEASE_LOCK();
 }
 /*---------------------------------------------------------------------------*/
-/*
- * Interrupt leaves frame intact in FIFO.
- */
 #if CC2420_TIMETABLE_PROFILING
 #define cc2420_timetable_size 16
 TIMETABLE(cc2420_timetable);
 TIMETABLE_AGGREGATE(aggregate_time, 10);
 #endif /* CC2420_TIMETABLE_PROFILING */
+#if CC2420_RX_RING
+/* Move the frames in the RX FIFO to the RX ring. Called from the
+   FIFOP interrupt, or with the lock held. */
+static void
+drain_rx_fifo(void)
+{
+  struct radio_ring_frame *f;
+  uint8_t footer[2];
+  uint8_t len;
+#if CC2420_CONF_CHECKSUM
+  uint16_t checksum;
+#endif /* CC2420_CONF_CHECKSUM */
+
+  while(CC2420_FIFOP_IS_1) {
+    if(!CC2420_FIFO_IS_1) {
+      /* FIFOP = 1 and FIFO = 0 signals a FIFO overflow. */
+      flushrx();
+      RIMESTATS_ADD(rxoverflow);
+      break;
+    }
+
+    f = radio_ring_alloc(&rx_ring);
+    if(f == NULL) {
+      /* The frame is left in the FIFO until cc2420_read() has made
+         room for it. */
+      RIMESTATS_ADD(rxringfull);
+      break;
+    }
+
+    cc2420_packets_read++;
+
+    getrxbyte(&len);
+
+    if(len > CC2420_MAX_PACKET_LEN) {
+      /* Oops, we must be out of sync. */
+      flushrx();
+      RIMESTATS_ADD(badsynch);
+      break;
+    }
+
+    if(len <= AUX_LEN) {
+      flushrx();
+      RIMESTATS_ADD(tooshort);
+      break;
+    }
+
+    if(len - AUX_LEN > RADIO_RING_FRAME_SIZE) {
+      flushrx();
+      RIMESTATS_ADD(toolong);
+      break;
+    }
+
+    getrxdata(f->data, len - AUX_LEN);
+#if CC2420_CONF_CHECKSUM
+    getrxdata(&checksum, CHECKSUM_LEN);
+#endif /* CC2420_CONF_CHECKSUM */
+    getrxdata(footer, FOOTER_LEN);
+
+#if CC2420_CONF_CHECKSUM
+    if(footer[1] & FOOTER1_CRC_OK &&
+       checksum == crc16_data(f->data, len - AUX_LEN, 0)) {
+#else
+    if(footer[1] & FOOTER1_CRC_OK) {
+#endif /* CC2420_CONF_CHECKSUM */
+      f->timestamp = cc2420_sfd_start_time;
+      f->len = len - AUX_LEN;
+      f->rssi = footer[0];
+      f->lqi = footer[1] & FOOTER1_CORRELATION;
+      radio_ring_put(&rx_ring);
+      RIMESTATS_ADD(llrx);
+    } else {
+      RIMESTATS_ADD(badcrc);
+    }
+  }
+}
+#endif /* CC2420_RX_RING */
+/*---------------------------------------------------------------------------*/
+/*
+ * Without an RX ring, the interrupt leaves the frame intact in the FIFO.
+ */
 int
 cc2420_interrupt(void)
 {
   CC2420_CLEAR_FIFOP_INT();
+#if CC2420_RX_RING
+  /* The frames are read out right away, unless the interrupt came in
+     the middle of another SPI transaction. The driver process then
+     reads them with cc2420_read(). */
+  if(!SPI_IS_BUSY()) {
+    drain_rx_fifo();
+  }
+#endif /* CC2420_RX_RING */
   process_poll(&cc2420_process);
 #if CC2420_TIMETABLE_PROFILING
   timetable_clear(&cc2420_timetable);
   TIMETABLE_TIMESTAMP(cc2420_timetable, "interrupt");
 #endif /* CC2420_TIMETABLE_PROFILING */
 
+#if !CC2420_RX_RING
   last_packet_timestamp = cc2420_sfd_start_time;
+#endif /* !CC2420_RX_RING */
   pending++;
   cc2420_packets_seen++;
   return 1;
@@ -642,9 +752,9 @@ PROCESS_THREAD(cc2420_process, ev, data)
     PRINTF("cc2420_process: calling receiver callback\n");
 
     packetbuf_clear();
-    packetbuf_set_attr(PACKETBUF_ATTR_TIMESTAMP, last_packet_timestamp);
     len = cc2420_read(packetbuf_dataptr(), PACKETBUF_SIZE);
-    
+    packetbuf_set_attr(PACKETBUF_ATTR_TIMESTAMP, last_packet_timestamp);
+
     packetbuf_set_datalen(len);
     
     NETSTACK_RDC.input();
@@ -659,6 +769,51 @@ PROCESS_THREAD(cc2420_process, ev, data)
   PROCESS_END();
 }
 /*---------------------------------------------------------------------------*/
+#if CC2420_RX_RING
+static int
+cc2420_read(void *buf, unsigned short bufsize)
+{
+  struct radio_ring_frame *f;
+  int len;
+
+  if(CC2420_FIFOP_IS_1) {
+    /* Move frames that the interrupt could not read, or that did not
+       fit in the ring, to the ring first. */
+    GET_LOCK();
+    drain_rx_fifo();
+    RELEASE_LOCK();
+  }
+
+  f = radio_ring_peek(&rx_ring);
+  if(f == NULL) {
+    return 0;
+  }
+
+  pending = 0;
+
+  if(f->len > bufsize) {
+    RIMESTATS_ADD(toolong);
+    len = 0;
+  } else {
+    len = f->len;
+    memcpy(buf, f->data, len);
+    last_packet_timestamp = f->timestamp;
+    cc2420_last_rssi = f->rssi;
+    cc2420_last_correlation = f->lqi;
+
+    packetbuf_set_attr(PACKETBUF_ATTR_RSSI, cc2420_last_rssi);
+    packetbuf_set_attr(PACKETBUF_ATTR_LINK_QUALITY, cc2420_last_correlation);
+  }
+  radio_ring_remove(&rx_ring);
+
+  if(radio_ring_elements(&rx_ring) > 0 || CC2420_FIFOP_IS_1) {
+    /* Another packet has been received and needs attention. */
+    process_poll(&cc2420_process);
+  }
+
+  return len;
+}
+#else /* CC2420_RX_RING */
 static int
 cc2420_read(void *buf, unsigned short bufsize)
 {
@@ -742,6 +897,7 @@ cc2420_read(void *buf, unsigned short bufsize)
        * full length frame and is signaled by FIFOP = 1 and FIFO =
        * 0. */
       flushrx();
+      RIMESTATS_ADD(rxoverflow);
     } else {
       /* Another packet has been received and needs attention. */
       process_poll(&cc2420_process);
@@ -756,6 +912,7 @@ cc2420_read(void *buf, unsigned short bufsize)
 
   return len - AUX_LEN;
 }
+#endif /* CC2420_RX_RING */
 /*---------------------------------------------------------------------------*/
 void
 cc2420_set_txpower(uint8_t power)
@@ -872,7 +1029,11 @@ cc2420_receiving_packet(void)
 static int
 pending_packet(void)
 {
+#if CC2420_RX_RING
+  return CC2420_FIFOP_IS_1 || radio_ring_elements(&rx_ring) > 0;
+#else
   return CC2420_FIFOP_IS_1;
+#endif /* CC2420_RX_RING */
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A ring of received radio frames.
+ */
+
+#include "dev/radio-ring.h"
+
+#include <stddef.h>
+
+/* The pointers run freely from 0 to 255 and are masked when a slot
+   is accessed, so all slots can be used and the ring is full when the
+   pointers are a whole ring apart. */
+/*---------------------------------------------------------------------------*/
+struct radio_ring_frame *
+radio_ring_alloc(struct radio_ring *r)
+{
+  if((uint8_t)(r->put_ptr - r->get_ptr) > r->mask) {
+    return NULL;
+  }
+  return &r->frames[r->put_ptr & r->mask];
+}
+/*---------------------------------------------------------------------------*/
+void
+radio_ring_put(struct radio_ring *r)
+{
+  r->put_ptr++;
+}
+/*---------------------------------------------------------------------------*/
+struct radio_ring_frame *
+radio_ring_peek(struct radio_ring *r)
+{
+  if(r->put_ptr == r->get_ptr) {
+    return NULL;
+  }
+  return &r->frames[r->get_ptr & r->mask];
+}
+/*---------------------------------------------------------------------------*/
+void
+radio_ring_remove(struct radio_ring *r)
+{
+  if(r->put_ptr != r->get_ptr) {
+    r->get_ptr++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+radio_ring_elements(struct radio_ring *r)
+{
+  return (uint8_t)(r->put_ptr - r->get_ptr);
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A ring of received radio frames.
+ *
+ *         A radio driver fills the ring from its receive interrupt
+ *         and the driver process empties it, so that frames are moved
+ *         out of the radio's small RX FIFO as soon as they arrive.
+ *         There is one writer and one reader, and each of them only
+ *         changes its own index, so no locking is needed as long as
+ *         the uint8_t indices are read and written atomically.
+ */
+
+#ifndef __RADIO_RING_H__
+#define __RADIO_RING_H__
+
+#include "contiki-conf.h"
+#include "sys/rtimer.h"
+
+#ifdef RADIO_RING_CONF_FRAME_SIZE
+#define RADIO_RING_FRAME_SIZE RADIO_RING_CONF_FRAME_SIZE
+#else
+#define RADIO_RING_FRAME_SIZE 127
+#endif /* RADIO_RING_CONF_FRAME_SIZE */
+
+struct radio_ring_frame {
+  rtimer_clock_t timestamp;
+  uint8_t len;
+  uint8_t rssi;
+  uint8_t lqi;
+  uint8_t data[RADIO_RING_FRAME_SIZE];
+};
+
+struct radio_ring {
+  struct radio_ring_frame *frames;
+  uint8_t mask;
+  volatile uint8_t put_ptr, get_ptr;
+};
+
+/**
+ * \brief      Declare a radio ring
+ * \param name The name of the ring
+ * \param size The number of frames in the ring, a power of two
+ *             no larger than 128
+ */
+#define RADIO_RING(name, size)                                  \
+  static struct radio_ring_frame name##_frames[size];           \
+  static struct radio_ring name = { name##_frames, (size) - 1, 0, 0 }
+
+/**
+ * \brief      Get the slot for the next frame to put in the ring
+ * \param r    A pointer to the ring
+ * \return     A pointer to the slot, or NULL if the ring is full
+ *
+ *             The frame is not visible to the reader until
+ *             radio_ring_put() has been called.
+ */
+struct radio_ring_frame *radio_ring_alloc(struct radio_ring *r);
+
+/**
+ * \brief      Put the frame returned by radio_ring_alloc() in the ring
+ * \param r    A pointer to the ring
+ */
+void radio_ring_put(struct radio_ring *r);
+
+/**
+ * \brief      Get the oldest frame in the ring without removing it
+ * \param r    A pointer to the ring
+ * \return     A pointer to the frame, or NULL if the ring is empty
+ */
+struct radio_ring_frame *radio_ring_peek(struct radio_ring *r);
+
+/**
+ * \brief      Remove the oldest frame from the ring
+ * \param r    A pointer to the ring
+ */
+void radio_ring_remove(struct radio_ring *r);
+
+/**
+ * \brief      Get the number of frames in the ring
+ * \param r    A pointer to the ring
+ */
+int radio_ring_elements(struct radio_ring *r);
+
+#endif /* __RADIO_RING_H__ */
@@ -50,6 +50,28 @@
 #define PRINTF(...) do {} while (0)
 #endif
 
+/* The symbol and string tables of the ELF file are read into this
+   buffer before relocation when they fit, instead of being read from
+   the file for every relocation. */
+#ifdef ELFLOADER_CONF_SYMTAB_CACHE_SIZE
+#define SYMTAB_CACHE_SIZE ELFLOADER_CONF_SYMTAB_CACHE_SIZE
+#else
+#define SYMTAB_CACHE_SIZE 0
+#endif
+
+/* The section headers and relocation entries are read sequentially
+   through this buffer, one cfs_read() per buffer instead of one
+   cfs_seek() and cfs_read() per entry. */
+#ifdef ELFLOADER_CONF_READ_BUFFER_SIZE
+#define READ_BUFFER_SIZE ELFLOADER_CONF_READ_BUFFER_SIZE
+#else
+#define READ_BUFFER_SIZE 64
+#endif
+
+#if READ_BUFFER_SIZE < 40
+#error ELFLOADER_CONF_READ_BUFFER_SIZE must hold a section header (40 bytes)
+#endif
+
 #define EI_NIDENT 16
 
 
@@ -133,10 +155,24 @@ struct relevant_section {
 
 char elfloader_unknown[30];	/* Name that caused link error. */
 
+struct elfloader_stats elfloader_stats;
+
 struct process * const * elfloader_autostart_processes;
 
 static struct relevant_section bss, data, rodata, text;
 
+#if SYMTAB_CACHE_SIZE > 0
+static char symtab_cache[SYMTAB_CACHE_SIZE];
+#endif
+static struct {
+  unsigned int offset;		/* File offset of buf[0]. */
+  int len;			/* Number of valid bytes in buf. */
+  char buf[READ_BUFFER_SIZE];
+} readbuf;
+
+static char *cached_symtab, *cached_strtab;
+static unsigned short cached_symtabsize, cached_strtabsize;
+
 static const unsigned char elf_magic_header[] =
   {0x7f, 0x45, 0x4c, 0x46,  /* 0x7f, 'E', 'L', 'F' */
    0x01,                    /* Only 32-bit objects. */
@@ -150,6 +186,8 @@ seek_read(int fd, unsigned int offset, char *buf, int len)
 {
   cfs_seek(fd, offset, CFS_SEEK_SET);
   cfs_read(fd, buf, len);
+  elfloader_stats.seeks++;
+  elfloader_stats.reads++;
 #if DEBUG
   {
     int i;
@@ -163,6 +201,28 @@ seek_read(int fd, unsigned int offset, char *buf, int len)
 #endif /* DEBUG */
 }
 /*---------------------------------------------------------------------------*/
+static void
+buffered_read(int fd, unsigned int offset, char *buf, int len)
+{
+  if(offset < readbuf.offset ||
+     offset + len > readbuf.offset + readbuf.len) {
+    cfs_seek(fd, offset, CFS_SEEK_SET);
+    readbuf.len = cfs_read(fd, readbuf.buf, sizeof(readbuf.buf));
+    readbuf.offset = offset;
+    elfloader_stats.seeks++;
+    elfloader_stats.reads++;
+    if(readbuf.len < len) {
+      /* Short file: pass on what could be read. */
+      if(readbuf.len > 0) {
+	memcpy(buf, readbuf.buf, readbuf.len);
+      }
+      readbuf.len = 0;
+      return;
+    }
+  }
+  memcpy(buf, &readbuf.buf[offset - readbuf.offset], len);
+}
+/*---------------------------------------------------------------------------*/
 /*
 static void
 seek_write(int fd, unsigned int offset, char *buf, int len)
@@ -172,6 +232,49 @@ seek_write(int fd, unsigned int offset, char *buf, int len)
 }
 */
 /*---------------------------------------------------------------------------*/
+static void
+read_symbol(int fd, unsigned int symtab, unsigned int offset,
+	    struct elf32_sym *s)
+{
+  if(cached_symtab != NULL &&
+     offset + sizeof(struct elf32_sym) <= cached_symtabsize) {
+    memcpy(s, &cached_symtab[offset], sizeof(struct elf32_sym));
+  } else {
+    seek_read(fd, symtab + offset, (char *)s, sizeof(struct elf32_sym));
+  }
+}
+/*---------------------------------------------------------------------------*/
+static const char *
+read_name(int fd, unsigned int strtab, unsigned int offset,
+	  char *name, int len)
+{
+  if(cached_strtab != NULL && offset < cached_strtabsize) {
+    /* The string table ends with a null byte, so the name is
+       terminated within the cache. */
+    return &cached_strtab[offset];
+  }
+  seek_read(fd, strtab + offset, name, len);
+  name[len - 1] = 0;
+  return name;
+}
+/*---------------------------------------------------------------------------*/
+static void *
+local_symbol_address(const struct elf32_sym *s)
+{
+  struct relevant_section *sect;
+
+  if(s->st_shndx == bss.number) {
+    sect = &bss;
+  } else if(s->st_shndx == data.number) {
+    sect = &data;
+  } else if(s->st_shndx == text.number) {
+    sect = &text;
+  } else {
+    return NULL;
+  }
+  return &(sect->address[s->st_value]);
+}
+/*---------------------------------------------------------------------------*/
 static void *
 find_local_symbol(int fd, const char *symbol,
 		  unsigned int symtab, unsigned short symtabsize,
@@ -179,25 +282,16 @@ find_local_symbol(int fd, const char *symbol,
 {
   struct elf32_sym s;
   unsigned int a;
-  char name[30];
-  struct relevant_section *sect;
+  char namebuf[30];
+  const char *name;
   
-  for(a = symtab; a < symtab + symtabsize; a += sizeof(s)) {
-    seek_read(fd, a, (char *)&s, sizeof(s));
+  for(a = 0; a < symtabsize; a += sizeof(s)) {
+    read_symbol(fd, symtab, a, &s);
 
     if(s.st_name != 0) {
-      seek_read(fd, strtab + s.st_name, name, sizeof(name));
+      name = read_name(fd, strtab, s.st_name, namebuf, sizeof(namebuf));
       if(strcmp(name, symbol) == 0) {
-	if(s.st_shndx == bss.number) {
-	  sect = &bss;
-	} else if(s.st_shndx == data.number) {
-	  sect = &data;
-	} else if(s.st_shndx == text.number) {
-	  sect = &text;
-	} else {
-	  return NULL;
-	}
-	return &(sect->address[s.st_value]);
+	return local_symbol_address(&s);
       }
     }
   }
@@ -219,7 +313,8 @@ relocate_section(int fd,
   int rel_size = 0;
   struct elf32_sym s;
   unsigned int a;
-  char name[30];
+  char namebuf[30];
+  const char *name;
   char *addr;
   struct relevant_section *sect;
 
@@ -231,18 +326,21 @@ relocate_section(int fd,
   }
   
   for(a = section; a < section + size; a += rel_size) {
-    seek_read(fd, a, (char *)&rela, rel_size);
-    seek_read(fd,
-	      symtab + sizeof(struct elf32_sym) * ELF32_R_SYM(rela.r_info),
-	      (char *)&s, sizeof(s));
+    buffered_read(fd, a, (char *)&rela, rel_size);
+    elfloader_stats.relocations++;
+    read_symbol(fd, symtab,
+		sizeof(struct elf32_sym) * ELF32_R_SYM(rela.r_info), &s);
     if(s.st_name != 0) {
-      seek_read(fd, strtab + s.st_name, name, sizeof(name));
+      name = read_name(fd, strtab, s.st_name, namebuf, sizeof(namebuf));
       PRINTF("name: %s\n", name);
       addr = (char *)symtab_lookup(name);
       /* ADDED */
       if(addr == NULL) {
 	PRINTF("name not found in global: %s\n", name);
-	addr = find_local_symbol(fd, name, symtab, symtabsize, strtab);
+	/* A symbol name occurs only once in the symbol table of an
+	   object file, so the symbol of the relocation is the one
+	   that defines the name, if it is defined at all. */
+	addr = local_symbol_address(&s);
 	PRINTF("found address %p\n", addr);
       }
       if(addr == NULL) {
@@ -256,7 +354,7 @@ relocate_section(int fd,
 	  sect = &text;
 	} else {
 	  PRINTF("elfloader unknown name: '%30s'\n", name);
-	  memcpy(elfloader_unknown, name, sizeof(elfloader_unknown));
+	  strncpy(elfloader_unknown, name, sizeof(elfloader_unknown));
 	  elfloader_unknown[sizeof(elfloader_unknown) - 1] = 0;
 	  return ELFLOADER_SYMBOL_NOT_FOUND;
 	}
@@ -295,13 +393,14 @@ find_program_processes(int fd,
 {
   struct elf32_sym s;
   unsigned int a;
-  char name[30];
+  char namebuf[30];
+  const char *name;
   
-  for(a = symtab; a < symtab + size; a += sizeof(s)) {
-    seek_read(fd, a, (char *)&s, sizeof(s));
+  for(a = 0; a < size; a += sizeof(s)) {
+    read_symbol(fd, symtab, a, &s);
 
     if(s.st_name != 0) {
-      seek_read(fd, strtab + s.st_name, name, sizeof(name));
+      name = read_name(fd, strtab, s.st_name, namebuf, sizeof(namebuf));
       if(strcmp(name, "autostart_processes") == 0) {
 	return &data.address[s.st_value];
       }
@@ -333,8 +432,8 @@ print_chars(unsigned char *ptr, int num)
 }
 #endif /* 0 */
 /*---------------------------------------------------------------------------*/
-int
-elfloader_load(int fd)
+static int
+load(int fd)
 {
   struct elf32_ehdr ehdr;
   struct elf32_shdr shdr;
@@ -359,6 +458,8 @@ elfloader_load(int fd)
   int ret;
 
   elfloader_unknown[0] = 0;
+  cached_symtab = cached_strtab = NULL;
+  readbuf.len = 0;
 
   /* The ELF header is located at the start of the buffer. */
   seek_read(fd, 0, (char *)&ehdr, sizeof(ehdr));
@@ -418,7 +519,7 @@ elfloader_load(int fd)
   shdrptr = ehdr.e_shoff;
   for(i = 0; i < shdrnum; ++i) {
 
-    seek_read(fd, shdrptr, (char *)&shdr, sizeof(shdr));
+    buffered_read(fd, shdrptr, (char *)&shdr, sizeof(shdr));
     
     /* The name of the section is contained in the strings table. */
     nameptr = strs + shdr.sh_name;
@@ -436,7 +537,10 @@ elfloader_load(int fd)
       PRINTF("symtab\n");
       symtaboff = shdr.sh_offset;
       symtabsize = shdr.sh_size;
-    } else if(shdr.sh_type == SHT_STRTAB/*strncmp(name, ".strtab", 7) == 0*/) {
+    } else if(shdr.sh_type == SHT_STRTAB && i != ehdr.e_shstrndx
+	      /*strncmp(name, ".strtab", 7) == 0*/) {
+      /* The section names are in a string table of their own, which
+	 must not be taken for the symbol string table. */
       PRINTF("strtab\n");
       strtaboff = shdr.sh_offset;
       strtabsize = shdr.sh_size;
@@ -502,6 +606,18 @@ elfloader_load(int fd)
     return ELFLOADER_NO_TEXT;
   }
 
+#if SYMTAB_CACHE_SIZE > 0
+  if((unsigned long)symtabsize + strtabsize <= SYMTAB_CACHE_SIZE) {
+    cached_symtab = symtab_cache;
+    cached_strtab = symtab_cache + symtabsize;
+    cached_symtabsize = symtabsize;
+    cached_strtabsize = strtabsize;
+    seek_read(fd, symtaboff, cached_symtab, symtabsize);
+    seek_read(fd, strtaboff, cached_strtab, strtabsize);
+    cached_strtab[strtabsize - 1] = 0;
+  }
+#endif /* SYMTAB_CACHE_SIZE > 0 */
+
   PRINTF("before allocate ram\n");
   bss.address = (char *)elfloader_arch_allocate_ram(bsssize + datasize);
   data.address = (char *)bss.address + bsssize;
@@ -586,3 +702,16 @@ elfloader_load(int fd)
   }
 }
 /*---------------------------------------------------------------------------*/
+int
+elfloader_load(int fd)
+{
+  clock_time_t start;
+  int ret;
+
+  memset(&elfloader_stats, 0, sizeof(elfloader_stats));
+  start = clock_time();
+  ret = load(fd);
+  elfloader_stats.time = clock_time() - start;
+  return ret;
+}
+/*---------------------------------------------------------------------------*/
@@ -75,6 +75,7 @@
 #define __ELFLOADER_H__
 
 #include "cfs/cfs.h"
+#include "sys/clock.h"
 
 /**
  * Return value from elfloader_load() indicating that loading worked.
@@ -158,6 +159,22 @@ extern struct process * const * elfloader_autostart_processes;
  */
 extern char elfloader_unknown[30];
 
+/**
+ * File system operations and time spent by the last call to
+ * elfloader_load(). Only the operations of the generic loader are
+ * counted: the architecture specific code typically adds one seek
+ * and one write per relocation, and the reads that copy the text
+ * segment into program memory.
+ */
+struct elfloader_stats {
+  unsigned short reads;
+  unsigned short seeks;
+  unsigned short relocations;
+  clock_time_t time;
+};
+
+extern struct elfloader_stats elfloader_stats;
+
 #ifndef ELFLOADER_DATAMEMORY_SIZE
 #ifdef ELFLOADER_CONF_DATAMEMORY_SIZE
 #define ELFLOADER_DATAMEMORY_SIZE ELFLOADER_CONF_DATAMEMORY_SIZE
@@ -41,4 +41,17 @@ extern const int symbols_nelts;
 
 extern const struct symbols symbols[/* symbols_nelts */];
 
+/* A perfect hash of the symbols[] names, generated by
+   tools/mknmlist. The name hashed with seed 0 selects a bucket, and
+   the name hashed with the seed of that bucket selects a slot that
+   holds the index of the name in symbols[]. */
+struct symbols_hash {
+  unsigned short nbuckets;
+  unsigned short nslots;
+  const unsigned short *seeds;
+  const unsigned short *slots;
+};
+
+extern const struct symbols_hash symbols_hash;
+
 #endif /* __SYMBOLS_DEF_H__ */
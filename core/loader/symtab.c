@@ -41,10 +41,16 @@
 #define SYMTAB_CONF_BINARY_SEARCH 1
 #endif
 
+/* Look names up in the perfect hash generated by tools/mknmlist,
+   falling back to searching symbols[] if the table is empty. */
+#ifndef SYMTAB_CONF_HASH
+#define SYMTAB_CONF_HASH 1
+#endif
+
 /*---------------------------------------------------------------------------*/
 #if SYMTAB_CONF_BINARY_SEARCH
-void *
-symtab_lookup(const char *name)
+static void *
+search(const char *name)
 {
   int start, middle, end;
   int r;
@@ -67,8 +73,8 @@ symtab_lookup(const char *name)
   return NULL;
 }
 #else /* SYMTAB_CONF_BINARY_SEARCH */
-void *
-symtab_lookup(const char *name)
+static void *
+search(const char *name)
 {
   const struct symbols *s;
   for(s = symbols; s->name != NULL; ++s) {
@@ -80,3 +86,45 @@ symtab_lookup(const char *name)
 }
 #endif /* SYMTAB_CONF_BINARY_SEARCH */
 /*---------------------------------------------------------------------------*/
+#if SYMTAB_CONF_HASH
+static unsigned short
+symtab_hash(unsigned short seed, const char *name)
+{
+  unsigned short h;
+
+  /* Must be kept in sync with symhash() in tools/mknmlist. */
+  h = seed;
+  while(*name != 0) {
+    h = h * 31 + (unsigned char)*name++;
+  }
+  return h;
+}
+/*---------------------------------------------------------------------------*/
+void *
+symtab_lookup(const char *name)
+{
+  unsigned short seed, i;
+
+  if(symbols_hash.nslots == 0) {
+    return search(name);
+  }
+
+  seed = symbols_hash.seeds[symtab_hash(0, name) % symbols_hash.nbuckets];
+  i = symbols_hash.slots[symtab_hash(seed, name) % symbols_hash.nslots];
+
+  /* A name that is not in the table still maps to some slot, so the
+     name in that slot must be compared. Empty slots hold an index
+     past the last symbol. */
+  if(i < symbols_nelts - 1 && strcmp(name, symbols[i].name) == 0) {
+    return symbols[i].value;
+  }
+  return NULL;
+}
+#else /* SYMTAB_CONF_HASH */
+void *
+symtab_lookup(const char *name)
+{
+  return search(name);
+}
+#endif /* SYMTAB_CONF_HASH */
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         The link statistics module: a table of link quality
+ *         estimates shared by the network stacks and MAC layers.
+ */
+
+#include "net/link-stats.h"
+#include "net/mac/mac.h"
+#include "net/packetbuf.h"
+#include "lib/list.h"
+#include "lib/memb.h"
+
+#define DEBUG 0
+#if DEBUG
+#include <stdio.h>
+#define PRINTF(...) printf(__VA_ARGS__)
+#else
+#define PRINTF(...)
+#endif
+
+/* The weight, in percent, of the old ETX and RSSI in their EWMAs.
+   The ETX is computed exactly as the neighbor information module
+   used to compute it. */
+#define EWMA_SCALE             100
+#define ETX_ALPHA              90
+#define RSSI_ALPHA             90
+
+/* A link is fresh when at least FRESHNESS_TARGET packets have been
+   sent to the neighbor recently, and the last one less than
+   FRESHNESS_EXPIRATION seconds ago. The packet count is halved for
+   every FRESHNESS_HALF_LIFE seconds without transmissions. */
+#define FRESHNESS_HALF_LIFE    120
+#define FRESHNESS_EXPIRATION   600
+#define FRESHNESS_TARGET       4
+#define FRESHNESS_MAX          16
+
+#define MAX_FAILURES           255
+
+MEMB(link_stats_memb, struct link_stats, LINK_STATS_NUM);
+/* The neighbors in order of last use, most recent first. */
+LIST(link_stats_list);
+static struct link_stats *hash[LINK_STATS_HASH_SIZE];
+/*---------------------------------------------------------------------------*/
+static struct link_stats **
+bucket(const rimeaddr_t *addr)
+{
+  uint8_t h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < sizeof(rimeaddr_t); i++) {
+    h ^= addr->u8[i];
+  }
+  return &hash[h & (LINK_STATS_HASH_SIZE - 1)];
+}
+/*---------------------------------------------------------------------------*/
+static struct link_stats *
+find(const rimeaddr_t *addr)
+{
+  struct link_stats *s;
+
+  for(s = *bucket(addr); s != NULL; s = s->hash_next) {
+    if(rimeaddr_cmp(addr, &s->addr)) {
+      return s;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_from_hash(struct link_stats *stats)
+{
+  struct link_stats **p;
+
+  for(p = bucket(&stats->addr); *p != NULL; p = &(*p)->hash_next) {
+    if(*p == stats) {
+      *p = stats->hash_next;
+      return;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Find the statistics of a neighbor, or add the neighbor to the
+   table, and move it first in the LRU order. */
+static struct link_stats *
+lookup(const rimeaddr_t *addr)
+{
+  struct link_stats *s;
+  struct link_stats **b;
+
+  s = find(addr);
+  if(s != NULL) {
+    list_remove(link_stats_list, s);
+    list_push(link_stats_list, s);
+    return s;
+  }
+
+  s = memb_alloc(&link_stats_memb);
+  if(s == NULL) {
+    /* Replace the least recently used neighbor. */
+    s = list_chop(link_stats_list);
+    if(s == NULL) {
+      return NULL;
+    }
+    PRINTF("link-stats: replacing %d.%d\n",
+           s->addr.u8[sizeof(rimeaddr_t) - 2],
+           s->addr.u8[sizeof(rimeaddr_t) - 1]);
+    remove_from_hash(s);
+  }
+
+  rimeaddr_copy(&s->addr, addr);
+  s->etx = 0;
+  s->rssi = LINK_STATS_RSSI_UNKNOWN;
+  s->last_tx_time = 0;
+  s->freshness = 0;
+  s->failures = 0;
+  b = bucket(addr);
+  s->hash_next = *b;
+  *b = s;
+  list_push(link_stats_list, s);
+  return s;
+}
+/*---------------------------------------------------------------------------*/
+/* The packet count of the freshness at time now. */
+static uint8_t
+freshness(const struct link_stats *stats, uint16_t now)
+{
+  uint16_t half_lives;
+
+  half_lives = (uint16_t)(now - stats->last_tx_time) / FRESHNESS_HALF_LIFE;
+  return half_lives >= 8 ? 0 : stats->freshness >> half_lives;
+}
+/*---------------------------------------------------------------------------*/
+const struct link_stats *
+link_stats_from_lladdr(const rimeaddr_t *addr)
+{
+  return find(addr);
+}
+/*---------------------------------------------------------------------------*/
+int
+link_stats_is_fresh(const struct link_stats *stats)
+{
+  uint16_t now;
+
+  if(stats == NULL) {
+    return 0;
+  }
+  now = (uint16_t)clock_seconds();
+  return (uint16_t)(now - stats->last_tx_time) < FRESHNESS_EXPIRATION &&
+    freshness(stats, now) >= FRESHNESS_TARGET;
+}
+/*---------------------------------------------------------------------------*/
+void
+link_stats_packet_sent(const rimeaddr_t *addr, int status, int numtx)
+{
+  struct link_stats *stats;
+  uint16_t packet_etx;
+  uint16_t now;
+  uint8_t f;
+
+  if(rimeaddr_cmp(addr, &rimeaddr_null)) {
+    return;
+  }
+
+  switch(status) {
+  case MAC_TX_OK:
+    if(numtx > LINK_STATS_ETX_LIMIT) {
+      numtx = LINK_STATS_ETX_LIMIT;
+    }
+    packet_etx = numtx * LINK_STATS_ETX_DIVISOR;
+    break;
+  case MAC_TX_NOACK:
+    packet_etx = LINK_STATS_ETX_LIMIT * LINK_STATS_ETX_DIVISOR;
+    break;
+  default:
+    /* Do not penalize the ETX when collisions or transmission
+       errors occur. */
+    return;
+  }
+
+  stats = lookup(addr);
+  if(stats == NULL) {
+    return;
+  }
+
+  if(status == MAC_TX_OK) {
+    stats->failures = 0;
+  } else if(stats->failures < MAX_FAILURES) {
+    stats->failures++;
+  }
+
+  if(stats->etx == 0) {
+    stats->etx = packet_etx;
+  } else {
+    stats->etx = ((uint32_t)stats->etx * ETX_ALPHA +
+                  (uint32_t)packet_etx * (EWMA_SCALE - ETX_ALPHA)) / EWMA_SCALE;
+  }
+
+  now = (uint16_t)clock_seconds();
+  f = freshness(stats, now);
+  stats->freshness = f < FRESHNESS_MAX ? f + 1 : f;
+  stats->last_tx_time = now;
+
+  PRINTF("link-stats: %d.%d status %d numtx %d etx %u failures %u\n",
+         addr->u8[sizeof(rimeaddr_t) - 2], addr->u8[sizeof(rimeaddr_t) - 1],
+         status, numtx, stats->etx, stats->failures);
+}
+/*---------------------------------------------------------------------------*/
+void
+link_stats_input_callback(const rimeaddr_t *addr)
+{
+  struct link_stats *stats;
+  int16_t rssi;
+
+  if(rimeaddr_cmp(addr, &rimeaddr_null)) {
+    return;
+  }
+
+  stats = lookup(addr);
+  if(stats == NULL) {
+    return;
+  }
+
+  rssi = (int16_t)packetbuf_attr(PACKETBUF_ATTR_RSSI);
+  if(stats->rssi == LINK_STATS_RSSI_UNKNOWN) {
+    stats->rssi = rssi;
+  } else {
+    stats->rssi = ((int32_t)stats->rssi * RSSI_ALPHA +
+                   (int32_t)rssi * (EWMA_SCALE - RSSI_ALPHA)) / EWMA_SCALE;
+  }
+}
+/*---------------------------------------------------------------------------*/
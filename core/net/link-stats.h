@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         Declarations for the link statistics module.
+ *
+ *         The link statistics are kept in one table that is shared by
+ *         all users of link quality estimates: the neighbor
+ *         information module used by RPL, the Collect neighbor table,
+ *         and the CSMA queue management. The network drivers update
+ *         the table once for every packet that the MAC layer reports
+ *         as sent, and for every packet received.
+ */
+
+#ifndef LINK_STATS_H
+#define LINK_STATS_H
+
+#include "net/rime/rimeaddr.h"
+#include "sys/clock.h"
+
+/* The number of neighbors for which link statistics are kept. When
+   the table is full, the least recently used neighbor is replaced.
+   The default is the size of the neighbor attribute table that
+   neighbor-info used to keep its ETX in. */
+#ifdef LINK_STATS_CONF_NUM
+#define LINK_STATS_NUM LINK_STATS_CONF_NUM
+#elif defined(NEIGHBOR_CONF_MAX_NEIGHBORS)
+#define LINK_STATS_NUM NEIGHBOR_CONF_MAX_NEIGHBORS
+#else
+#define LINK_STATS_NUM 12
+#endif
+
+/* The number of hash buckets for neighbor lookups, a power of two. */
+#ifdef LINK_STATS_CONF_HASH_SIZE
+#define LINK_STATS_HASH_SIZE LINK_STATS_CONF_HASH_SIZE
+#else
+#define LINK_STATS_HASH_SIZE 4
+#endif
+
+/* The fix-point ETX divided by this value is the integer ETX. It is
+   the same as NEIGHBOR_INFO_ETX_DIVISOR. */
+#define LINK_STATS_ETX_DIVISOR 16
+
+/* The largest ETX of a link, which is also the ETX sample of a packet
+   that was never acknowledged. Unlike in the old neighbor-info
+   estimator, a packet that took more transmissions is also counted
+   as this many. */
+#define LINK_STATS_ETX_LIMIT   15
+
+#define LINK_STATS_RSSI_UNKNOWN 0x7fff
+
+struct link_stats {
+  struct link_stats *next;
+  struct link_stats *hash_next;
+  rimeaddr_t addr;
+  /* The EWMA of the number of transmissions per packet, in units of
+     1/LINK_STATS_ETX_DIVISOR, or 0 if no packet has been sent yet. */
+  uint16_t etx;
+  /* The EWMA of the RSSI of the packets received from the neighbor. */
+  int16_t rssi;
+  /* The time, in seconds, of the last packet sent to the neighbor. */
+  uint16_t last_tx_time;
+  /* The number of packets recently sent to the neighbor. It is halved
+     for every two minutes without transmissions. */
+  uint8_t freshness;
+  /* The number of consecutive packets to the neighbor that were
+     dropped without being acknowledged. */
+  uint8_t failures;
+};
+
+/**
+ * Get the link statistics of a neighbor.
+ *
+ * \param addr The link-layer address of the neighbor.
+ *
+ * \return The link statistics, or NULL if the neighbor is not in the
+ *         table.
+ */
+const struct link_stats *link_stats_from_lladdr(const rimeaddr_t *addr);
+
+/**
+ * Tell whether the ETX of a neighbor is based on enough recent
+ * transmissions to be trusted.
+ *
+ * \param stats The link statistics of the neighbor, or NULL.
+ *
+ * \return Returns 1 if the statistics are fresh, and 0 if not.
+ */
+int link_stats_is_fresh(const struct link_stats *stats);
+
+/**
+ * Update the link statistics after a unicast packet has been sent.
+ * Collisions and other errors that are not the fault of the link do
+ * not change the statistics.
+ *
+ * \param addr The link-layer address of the receiver.
+ *
+ * \param status The MAC status code for the packet.
+ *
+ * \param numtx The number of transmissions made for the packet.
+ */
+void link_stats_packet_sent(const rimeaddr_t *addr, int status, int numtx);
+
+/**
+ * Update the link statistics after a packet has been received. The
+ * RSSI is taken from the packet buffer attributes.
+ *
+ * \param addr The link-layer address of the sender.
+ */
+void link_stats_input_callback(const rimeaddr_t *addr);
+
+#endif /* LINK_STATS_H */
@@ -87,12 +87,27 @@
 #define WITH_PHASE_OPTIMIZATION 0
 #endif
 
+/* Adapt the channel check rate of the node to the traffic that it
+   receives. A node that receives many packets, such as a node that
+   forwards the traffic of others, checks the channel up to
+   2^CONTIKIMAC_CONF_ADAPTIVE_MAX_SHIFT times per cycle. The rate is
+   sent in the ContikiMAC header, so that neighbors can time their
+   transmissions with it. */
+#ifdef CONTIKIMAC_CONF_ADAPTIVE
+#define CONTIKIMAC_ADAPTIVE          CONTIKIMAC_CONF_ADAPTIVE
+#else
+#define CONTIKIMAC_ADAPTIVE          0
+#endif
+
 #if WITH_CONTIKIMAC_HEADER
 #define CONTIKIMAC_ID 0x00
 
 struct hdr {
   uint8_t id;
   uint8_t len;
+#if CONTIKIMAC_ADAPTIVE
+  uint8_t cycle_shift;
+#endif /* CONTIKIMAC_ADAPTIVE */
 };
 #endif /* WITH_CONTIKIMAC_HEADER */
 
@@ -114,6 +129,49 @@ struct hdr {
 #define SYNC_CYCLE_STARTS                    1
 #endif
 
+#if CONTIKIMAC_ADAPTIVE
+#if !WITH_CONTIKIMAC_HEADER
+#error CONTIKIMAC_CONF_ADAPTIVE requires CONTIKIMAC_CONF_WITH_CONTIKIMAC_HEADER
+#endif
+#if SYNC_CYCLE_STARTS
+#error CONTIKIMAC_CONF_ADAPTIVE requires RTIMER_ARCH_SECOND to be a power of two
+#endif
+
+/* The largest number of channel checks per cycle is 2 to the power of
+   CONTIKIMAC_ADAPTIVE_MAX_SHIFT. The shortest time between two channel
+   checks must be longer than GUARD_TIME. */
+#ifdef CONTIKIMAC_CONF_ADAPTIVE_MAX_SHIFT
+#define CONTIKIMAC_ADAPTIVE_MAX_SHIFT CONTIKIMAC_CONF_ADAPTIVE_MAX_SHIFT
+#else
+#define CONTIKIMAC_ADAPTIVE_MAX_SHIFT 2
+#endif
+
+/* A node that receives more than CONTIKIMAC_ADAPTIVE_THRESHOLD packets
+   per ADAPTIVE_PERIOD and channel check per cycle doubles its channel
+   check rate. It halves the rate again when it receives less than a
+   quarter of that. */
+#ifdef CONTIKIMAC_CONF_ADAPTIVE_THRESHOLD
+#define CONTIKIMAC_ADAPTIVE_THRESHOLD CONTIKIMAC_CONF_ADAPTIVE_THRESHOLD
+#else
+#define CONTIKIMAC_ADAPTIVE_THRESHOLD 4
+#endif
+
+#define ADAPTIVE_PERIOD                    (CLOCK_SECOND * 4)
+
+/* The channel is checked 2^cycle_shift times per cycle. A new value of
+   next_cycle_shift takes effect at the start of the next full cycle,
+   so that the channel checks stay at the phase that neighbors have
+   recorded for us. */
+static uint8_t cycle_shift, next_cycle_shift;
+static uint8_t check_in_cycle;
+static uint16_t packets_received;
+static struct ctimer adaptive_timer;
+
+#define CURRENT_CYCLE_TIME                 (CYCLE_TIME >> cycle_shift)
+#else /* CONTIKIMAC_ADAPTIVE */
+#define CURRENT_CYCLE_TIME                 CYCLE_TIME
+#endif /* CONTIKIMAC_ADAPTIVE */
+
 /* Are we currently receiving a burst? */
 static int we_are_receiving_burst = 0;
 /* Has the receiver been awoken by a burst we're sending? */
@@ -390,7 +448,13 @@ powercycle(struct rtimer *t, void *ptr)
 #endif
     }
 #else
-    cycle_start += CYCLE_TIME;
+    cycle_start += CURRENT_CYCLE_TIME;
+#if CONTIKIMAC_ADAPTIVE
+    check_in_cycle = (check_in_cycle + 1) & ((1 << cycle_shift) - 1);
+    if(check_in_cycle == 0) {
+      cycle_shift = next_cycle_shift;
+    }
+#endif /* CONTIKIMAC_ADAPTIVE */
 #endif
 
     packet_seen = 0;
@@ -474,21 +538,21 @@ powercycle(struct rtimer *t, void *ptr)
       }
     }
 
-    if(RTIMER_CLOCK_LT(RTIMER_NOW() - cycle_start, CYCLE_TIME - CHECK_TIME * 4)) {
+    if(RTIMER_CLOCK_LT(RTIMER_NOW() - cycle_start, CURRENT_CYCLE_TIME - CHECK_TIME * 4)) {
 	     /* Schedule the next powercycle interrupt, or sleep the mcu until then.
                 Sleeping will not exit from this interrupt, so ensure an occasional wake cycle
 				or foreground processing will be blocked until a packet is detected */
 #if RDC_CONF_MCU_SLEEP
       static uint8_t sleepcycle;
       if ((sleepcycle++<16) && !we_are_sending && !radio_is_on) {
-        rtimer_arch_sleep(CYCLE_TIME - (RTIMER_NOW() - cycle_start));
+        rtimer_arch_sleep(CURRENT_CYCLE_TIME - (RTIMER_NOW() - cycle_start));
       } else {
         sleepcycle = 0;
-        schedule_powercycle_fixed(t, CYCLE_TIME + cycle_start);
+        schedule_powercycle_fixed(t, CURRENT_CYCLE_TIME + cycle_start);
         PT_YIELD(&pt);
       }
 #else
-      schedule_powercycle_fixed(t, CYCLE_TIME + cycle_start);
+      schedule_powercycle_fixed(t, CURRENT_CYCLE_TIME + cycle_start);
       PT_YIELD(&pt);
 #endif
     }
@@ -589,6 +653,9 @@ send_packet(mac_callback_t mac_callback, void *mac_callback_ptr, struct rdc_buf_
   chdr = packetbuf_hdrptr();
   chdr->id = CONTIKIMAC_ID;
   chdr->len = hdrlen;
+#if CONTIKIMAC_ADAPTIVE
+  chdr->cycle_shift = cycle_shift;
+#endif /* CONTIKIMAC_ADAPTIVE */
   
   /* Create the MAC header for the data packet. */
   hdrlen = NETSTACK_FRAMER.create();
@@ -838,7 +905,7 @@ send_packet(mac_callback_t mac_callback, void *mac_callback_ptr, struct rdc_buf_
   if(!is_broadcast) {
     if(collisions == 0 && is_receiver_awake == 0) {
       phase_update(&phase_list, packetbuf_addr(PACKETBUF_ADDR_RECEIVER), encounter_time,
-                   ret);
+                   CYCLE_TIME, ret);
     }
   }
 #endif /* WITH_PHASE_OPTIMIZATION */
@@ -872,16 +939,19 @@ qsend_list(mac_callback_t sent, void *ptr, struct rdc_buf_list *buf_list)
     mac_call_sent_callback(sent, ptr, MAC_TX_COLLISION, 1);
     return;
   }
-  /* The receiver needs to be awoken before we send */
+  /* The receiver needs to be awoken before we send. Only the first
+     packet of the burst is timed with the phase of the receiver and
+     updates it. */
   is_receiver_awake = 0;
   do { /* A loop sending a burst of packets from buf_list */
     next = list_item_next(curr);
 
-    /* Prepare the packetbuf */
+    /* Prepare the packetbuf. The frame pending bit keeps the
+       receiver awake for the next packet. It is set explicitly, since
+       the attributes of a packet that failed in an earlier burst may
+       still have it set. */
     queuebuf_to_packetbuf(curr->buf);
-    if(next != NULL) {
-      packetbuf_set_attr(PACKETBUF_ATTR_PENDING, 1);
-    }
+    packetbuf_set_attr(PACKETBUF_ATTR_PENDING, next != NULL);
 
     /* Send the current packet */
     ret = send_packet(sent, ptr, curr);
@@ -937,8 +1007,17 @@ input_packet(void)
     }
     packetbuf_hdrreduce(sizeof(struct hdr));
     packetbuf_set_datalen(chdr->len);
+#if CONTIKIMAC_ADAPTIVE && WITH_PHASE_OPTIMIZATION
+    phase_set_cycle_shift(&phase_list, packetbuf_addr(PACKETBUF_ADDR_SENDER),
+                          chdr->cycle_shift);
+#endif /* CONTIKIMAC_ADAPTIVE && WITH_PHASE_OPTIMIZATION */
 #endif /* WITH_CONTIKIMAC_HEADER */
 
+#if WITH_PHASE_OPTIMIZATION
+    /* A neighbor that we hear from is kept in the phase list. */
+    phase_refresh(&phase_list, packetbuf_addr(PACKETBUF_ADDR_SENDER));
+#endif /* WITH_PHASE_OPTIMIZATION */
+
     if(packetbuf_datalen() > 0 &&
        packetbuf_totlen() > 0 &&
        (rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
@@ -948,6 +1027,13 @@ input_packet(void)
       /* This is a regular packet that is destined to us or to the
          broadcast address. */
 
+#if CONTIKIMAC_ADAPTIVE
+      if(!rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
+                       &rimeaddr_null)) {
+        packets_received++;
+      }
+#endif /* CONTIKIMAC_ADAPTIVE */
+
       /* If FRAME_PENDING is set, we are receiving a packets in a burst */
       we_are_receiving_burst = packetbuf_attr(PACKETBUF_ATTR_PENDING);
       if(we_are_receiving_burst) {
@@ -1006,12 +1092,36 @@ input_packet(void)
   }
 }
 /*---------------------------------------------------------------------------*/
+#if CONTIKIMAC_ADAPTIVE
+static void
+adapt_cycle_time(void *ptr)
+{
+  uint16_t threshold;
+
+  threshold = CONTIKIMAC_ADAPTIVE_THRESHOLD << next_cycle_shift;
+  if(packets_received > threshold &&
+     next_cycle_shift < CONTIKIMAC_ADAPTIVE_MAX_SHIFT) {
+    next_cycle_shift++;
+  } else if(packets_received < threshold / 4 && next_cycle_shift > 0) {
+    next_cycle_shift--;
+  }
+  PRINTF("contikimac: %u packets, %u checks per cycle\n",
+         packets_received, 1 << next_cycle_shift);
+  packets_received = 0;
+  ctimer_set(&adaptive_timer, ADAPTIVE_PERIOD, adapt_cycle_time, NULL);
+}
+#endif /* CONTIKIMAC_ADAPTIVE */
+/*---------------------------------------------------------------------------*/
 static void
 init(void)
 {
   radio_is_on = 0;
   PT_INIT(&pt);
 
+#if CONTIKIMAC_ADAPTIVE
+  ctimer_set(&adaptive_timer, ADAPTIVE_PERIOD, adapt_cycle_time, NULL);
+#endif /* CONTIKIMAC_ADAPTIVE */
+
   rtimer_set(&rt, RTIMER_NOW() + CYCLE_TIME, 1,
              (void (*)(struct rtimer *, void *))powercycle, NULL);
 
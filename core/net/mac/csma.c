@@ -38,6 +38,7 @@
  */
 
 #include "net/mac/csma.h"
+#include "net/link-stats.h"
 #include "net/packetbuf.h"
 #include "net/queuebuf.h"
 
@@ -76,11 +77,17 @@
 #error Change CSMA_CONF_MAX_MAC_TRANSMISSIONS in contiki-conf.h or in your Makefile.
 #endif /* CSMA_CONF_MAX_MAC_TRANSMISSIONS < 1 */
 
+/* Packet priority classes, served in strict priority order. */
+#define PRIORITY_DATA    0
+#define PRIORITY_CONTROL 1
+#define PRIORITY_ACK     2
+
 /* Packet metadata */
 struct qbuf_metadata {
   mac_callback_t sent;
   void *cptr;
   uint8_t max_transmissions;
+  uint8_t priority;
 };
 
 /* Every neighbor has its own packet queue */
@@ -90,10 +97,15 @@ struct neighbor_queue {
   struct ctimer transmit_timer;
   uint8_t transmissions;
   uint8_t collisions, deferrals;
+  /* Set when the transmit timer has expired and the first packet
+     waits for its turn in the scheduler. */
+  uint8_t ready;
+  uint16_t deficit;
   LIST_STRUCT(queued_packet_list);
 };
 
-/* The maximum number of co-existing neighbor queues */
+/* The maximum number of co-existing neighbor queues. Broadcast
+   packets have a separate queue that is not included. */
 #ifdef CSMA_CONF_MAX_NEIGHBOR_QUEUES
 #define CSMA_MAX_NEIGHBOR_QUEUES CSMA_CONF_MAX_NEIGHBOR_QUEUES
 #else
@@ -101,13 +113,63 @@ struct neighbor_queue {
 #endif /* CSMA_CONF_MAX_NEIGHBOR_QUEUES */
 
 #define MAX_QUEUED_PACKETS QUEUEBUF_NUM
+
+/* The number of packets that one neighbor queue may hold. By default,
+   every other queue, including the broadcast queue, can still get a
+   packet when one neighbor has used up its quota. */
+#ifdef CSMA_CONF_MAX_PACKETS_PER_NEIGHBOR
+#define CSMA_MAX_PACKETS_PER_NEIGHBOR CSMA_CONF_MAX_PACKETS_PER_NEIGHBOR
+#elif MAX_QUEUED_PACKETS > CSMA_MAX_NEIGHBOR_QUEUES
+#define CSMA_MAX_PACKETS_PER_NEIGHBOR \
+  (MAX_QUEUED_PACKETS - CSMA_MAX_NEIGHBOR_QUEUES)
+#else
+#define CSMA_MAX_PACKETS_PER_NEIGHBOR 1
+#endif /* CSMA_CONF_MAX_PACKETS_PER_NEIGHBOR */
+
+/* The number of bytes that a neighbor queue may send per round of the
+   deficit round robin scheduler. */
+#ifdef CSMA_CONF_DRR_QUANTUM
+#define CSMA_DRR_QUANTUM CSMA_CONF_DRR_QUANTUM
+#else
+#define CSMA_DRR_QUANTUM 64
+#endif /* CSMA_CONF_DRR_QUANTUM */
+
+/* Every consecutive NOACK drop to a neighbor, as counted in the link
+   statistics, halves the quota of the neighbor, so that packets to a
+   dead neighbor are dropped early instead of holding the queue
+   buffers. */
+#define AQM_MAX_FAILURES 7
+
+/* When set, all packets queued for a unicast neighbor are handed to
+   the RDC layer as one list, which lets it send them back to back
+   in a burst without waking the receiver up for every packet. */
+#ifdef CSMA_CONF_SEND_BURSTS
+#define CSMA_SEND_BURSTS CSMA_CONF_SEND_BURSTS
+#else
+#define CSMA_SEND_BURSTS 1
+#endif /* CSMA_CONF_SEND_BURSTS */
+
 MEMB(neighbor_memb, struct neighbor_queue, CSMA_MAX_NEIGHBOR_QUEUES);
 MEMB(packet_memb, struct rdc_buf_list, MAX_QUEUED_PACKETS);
 MEMB(metadata_memb, struct qbuf_metadata, MAX_QUEUED_PACKETS);
 LIST(neighbor_list);
 
+static struct neighbor_queue broadcast_queue;
+
+/* The neighbor queue whose turn it is in the round robin. */
+static struct neighbor_queue *round_robin;
+static struct ctimer schedule_timer;
+
+/* The neighbor queue that the RDC layer is sending a burst from, and
+   the number of packets of the burst that have been sent so far. */
+static struct neighbor_queue *burst_queue;
+static uint8_t burst_packets;
+
+struct csma_stats csma_stats;
+
 static void packet_sent(void *ptr, int status, int num_transmissions);
 static void transmit_packet_list(void *ptr);
+static void schedule(void *ptr);
 
 /* This shortcut is only meant to be used with sicslowmac and null RDC */
 #ifndef CSMA_SHORTCUT
@@ -131,6 +193,34 @@ neighbor_queue *neighbor_queue_from_addr(const rimeaddr_t *addr) {
   return NULL;
 }
 /*---------------------------------------------------------------------------*/
+static int
+neighbor_quota(const rimeaddr_t *addr)
+{
+  const struct link_stats *stats;
+  int quota;
+
+  quota = CSMA_MAX_PACKETS_PER_NEIGHBOR;
+  stats = link_stats_from_lladdr(addr);
+  if(stats != NULL) {
+    quota >>= stats->failures < AQM_MAX_FAILURES ?
+      stats->failures : AQM_MAX_FAILURES;
+  }
+  return quota > 0 ? quota : 1;
+}
+/*---------------------------------------------------------------------------*/
+static uint8_t
+packet_priority(void)
+{
+  switch(packetbuf_attr(PACKETBUF_ATTR_PACKET_TYPE)) {
+  case PACKETBUF_ATTR_PACKET_TYPE_ACK:
+    return PRIORITY_ACK;
+  case PACKETBUF_ATTR_PACKET_TYPE_CONTROL:
+    return PRIORITY_CONTROL;
+  default:
+    return PRIORITY_DATA;
+  }
+}
+/*---------------------------------------------------------------------------*/
 static clock_time_t
 default_timebase(void)
 {
@@ -148,25 +238,137 @@ default_timebase(void)
   return time;
 }
 /*---------------------------------------------------------------------------*/
+static int
+first_priority(struct neighbor_queue *n)
+{
+  struct rdc_buf_list *q = list_head(n->queued_packet_list);
+  if(!n->ready || q == NULL) {
+    return -1;
+  }
+  return ((struct qbuf_metadata *)q->ptr)->priority;
+}
+/*---------------------------------------------------------------------------*/
+static struct neighbor_queue *
+next_in_round(struct neighbor_queue *n)
+{
+  n = list_item_next(n);
+  return n != NULL ? n : list_head(neighbor_list);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Selects the neighbor queue to transmit from. Only the ready queues
+ * whose first packet has the highest priority class compete, and
+ * they share the radio with deficit round robin: on each visit, a
+ * queue gets CSMA_DRR_QUANTUM bytes of credit and may send its first
+ * packet if it has enough credit for it.
+ */
+static struct neighbor_queue *
+select_neighbor_queue(void)
+{
+  struct neighbor_queue *n;
+  struct rdc_buf_list *q;
+  int priority;
+  int visits;
+  int len;
+
+  priority = -1;
+  for(n = list_head(neighbor_list); n != NULL; n = list_item_next(n)) {
+    if(first_priority(n) > priority) {
+      priority = first_priority(n);
+    }
+  }
+  if(priority < 0) {
+    return NULL;
+  }
+
+  n = round_robin != NULL ? round_robin : list_head(neighbor_list);
+  visits = list_length(neighbor_list) *
+    (PACKETBUF_SIZE / CSMA_DRR_QUANTUM + 2);
+  while(visits-- > 0) {
+    if(first_priority(n) == priority) {
+      q = list_head(n->queued_packet_list);
+      len = queuebuf_datalen(q->buf);
+      if(n->deficit >= len) {
+        n->deficit -= len;
+        round_robin = n;
+        return n;
+      }
+    }
+    n = next_in_round(n);
+    if(first_priority(n) == priority) {
+      n->deficit += CSMA_DRR_QUANTUM;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
 static void
-transmit_packet_list(void *ptr)
+schedule(void *ptr)
 {
-  struct neighbor_queue *n = ptr;
-  if(n) {
-    struct rdc_buf_list *q = list_head(n->queued_packet_list);
-    if(q != NULL) {
-      PRINTF("csma: preparing number %d %p, queue len %d\n", n->transmissions, q,
-          list_length(n->queued_packet_list));
-      /* Send packets in the neighbor's list */
-      NETSTACK_RDC.send_list(packet_sent, n, q);
+  struct neighbor_queue *n;
+  struct rdc_buf_list *q;
+
+  n = select_neighbor_queue();
+  if(n == NULL) {
+    return;
+  }
+  n->ready = 0;
+  q = list_head(n->queued_packet_list);
+  PRINTF("csma: preparing number %d %p, queue len %d\n", n->transmissions, q,
+         list_length(n->queued_packet_list));
+  if(CSMA_SEND_BURSTS && n != &broadcast_queue) {
+    /* Send packets in the neighbor's list. The queue may be freed
+       by packet_sent() before send_list() returns. */
+    burst_queue = n;
+    burst_packets = 0;
+    NETSTACK_RDC.send_list(packet_sent, n, q);
+    burst_queue = NULL;
+  } else {
+    /* Broadcasts are sent one at a time, since neighbors that missed
+       the first packet of a burst would miss the rest as well. */
+    queuebuf_to_packetbuf(q->buf);
+    NETSTACK_RDC.send(packet_sent, n);
+  }
 #if CSMA_SHORTCUT
-      packet_sent_cb(n, mac_status);
+  packet_sent_cb(n, mac_status);
 #endif
+
+  /* Let other processes run before serving the next queue. */
+  for(n = list_head(neighbor_list); n != NULL; n = list_item_next(n)) {
+    if(first_priority(n) >= 0) {
+      ctimer_set(&schedule_timer, 0, schedule, NULL);
+      break;
     }
   }
 }
 /*---------------------------------------------------------------------------*/
 static void
+transmit_packet_list(void *ptr)
+{
+  struct neighbor_queue *n = ptr;
+  if(n) {
+    n->ready = 1;
+    schedule(NULL);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+free_neighbor_queue(struct neighbor_queue *n)
+{
+  if(round_robin == n) {
+    round_robin = list_item_next(n);
+  }
+  if(burst_queue == n) {
+    burst_queue = NULL;
+  }
+  ctimer_stop(&n->transmit_timer);
+  list_remove(neighbor_list, n);
+  if(n != &broadcast_queue) {
+    memb_free(&neighbor_memb, n);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
 free_first_packet(struct neighbor_queue *n)
 {
   struct rdc_buf_list *q = list_head(n->queued_packet_list);
@@ -187,9 +389,7 @@ free_first_packet(struct neighbor_queue *n)
       ctimer_set(&n->transmit_timer, default_timebase(), transmit_packet_list, n);
     } else {
       /* This was the last packet in the queue, we free the neighbor */
-      ctimer_stop(&n->transmit_timer);
-      list_remove(neighbor_list, n);
-      memb_free(&neighbor_memb, n);
+      free_neighbor_queue(n);
     }
   }
 }
@@ -282,12 +482,17 @@ packet_sent(void *ptr, int status, int num_transmissions)
     } else {
       PRINTF("csma: drop with status %d after %d transmissions, %d collisions\n",
              status, n->transmissions, n->collisions);
+      csma_stats.drop_noack++;
       free_first_packet(n);
       mac_call_sent_callback(sent, cptr, status, num_tx);
     }
   } else {
     if(status == MAC_TX_OK) {
       PRINTF("csma: rexmit ok %d\n", n->transmissions);
+      csma_stats.sent++;
+      if(n == burst_queue && burst_packets++ > 0) {
+        csma_stats.sent_in_burst++;
+      }
     } else {
       PRINTF("csma: rexmit failed %d: %d\n", n->transmissions, status);
     }
@@ -297,96 +502,161 @@ packet_sent(void *ptr, int status, int num_transmissions)
 }
 /*---------------------------------------------------------------------------*/
 static void
+enqueue(struct neighbor_queue *n, struct rdc_buf_list *q)
+{
+  struct rdc_buf_list *prev;
+  struct rdc_buf_list *p;
+  uint8_t priority;
+
+  /* Keep the queue sorted on priority, first in first out within a
+     class. The first packet always stays first, since it may be
+     being retransmitted, deferred by the RDC layer, or be the next
+     packet of a burst that is being sent. */
+  priority = ((struct qbuf_metadata *)q->ptr)->priority;
+  prev = NULL;
+  p = list_head(n->queued_packet_list);
+  if(p != NULL) {
+    prev = p;
+    p = list_item_next(p);
+  }
+  while(p != NULL && ((struct qbuf_metadata *)p->ptr)->priority >= priority) {
+    prev = p;
+    p = list_item_next(p);
+  }
+  list_insert(n->queued_packet_list, prev, q);
+}
+/*---------------------------------------------------------------------------*/
+static void
 send_packet(mac_callback_t sent, void *ptr)
 {
   struct rdc_buf_list *q;
   struct neighbor_queue *n;
+  static const rimeaddr_t *addr;
+  const struct link_stats *stats;
 
-  /* If the packet is a broadcast, do not allocate a queue
-     entry. Instead, just send it out.  */
-  if(!rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
-                   &rimeaddr_null)) {
-    static const rimeaddr_t *addr;
-    addr = packetbuf_addr(PACKETBUF_ADDR_RECEIVER);
-
-    /* Look for the neighbor entry */
-    n = neighbor_queue_from_addr(addr);
-    if(n == NULL) {
-      /* Allocate a new neighbor entry */
+  addr = packetbuf_addr(PACKETBUF_ADDR_RECEIVER);
+
+#if CSMA_SHORTCUT
+  /* The shortcut needs the status of broadcasts right away, so they
+     are sent without queuing. */
+  if(rimeaddr_cmp(addr, &rimeaddr_null)) {
+    PRINTF("csma: send broadcast\n");
+    NETSTACK_RDC.send(packet_sent, ptr);
+    if(sent) {
+      sent(ptr, mac_status, 1);
+    }
+    return;
+  }
+#endif /* CSMA_SHORTCUT */
+
+  /* Look for the neighbor entry. Broadcast packets are queued under
+     the null address. */
+  n = neighbor_queue_from_addr(addr);
+  if(n == NULL) {
+    /* Allocate a new neighbor entry */
+    if(rimeaddr_cmp(addr, &rimeaddr_null)) {
+      n = &broadcast_queue;
+    } else {
       n = memb_alloc(&neighbor_memb);
-      if(n != NULL) {
-        /* Init neighbor entry */
-        rimeaddr_copy(&n->addr, addr);
-        n->transmissions = 0;
-        n->collisions = 0;
-        n->deferrals = 0;
-        /* Init packet list for this neighbor */
-        LIST_STRUCT_INIT(n, queued_packet_list);
-        /* Add neighbor to the list */
-        list_add(neighbor_list, n);
+    }
+    if(n != NULL) {
+      /* Init neighbor entry */
+      rimeaddr_copy(&n->addr, addr);
+      n->transmissions = 0;
+      n->collisions = 0;
+      n->deferrals = 0;
+      n->ready = 0;
+      n->deficit = 0;
+      /* Init packet list for this neighbor */
+      LIST_STRUCT_INIT(n, queued_packet_list);
+      /* Add neighbor to the list */
+      list_add(neighbor_list, n);
+    }
+  }
+
+  if(n != NULL) {
+    if(list_length(n->queued_packet_list) >= neighbor_quota(addr)) {
+      PRINTF("csma: neighbor over its quota, dropping packet\n");
+      stats = link_stats_from_lladdr(addr);
+      if(stats != NULL && stats->failures > 0) {
+        csma_stats.drop_aqm++;
+      } else {
+        csma_stats.drop_quota++;
       }
+      mac_call_sent_callback(sent, ptr, MAC_TX_ERR, 1);
+      return;
     }
 
-    if(n != NULL) {
-      /* Add packet to the neighbor's queue */
-      q = memb_alloc(&packet_memb);
-      if(q != NULL) {
-        q->ptr = memb_alloc(&metadata_memb);
-        if(q->ptr != NULL) {
-          q->buf = queuebuf_new_from_packetbuf();
-          if(q->buf != NULL) {
-            struct qbuf_metadata *metadata = (struct qbuf_metadata *)q->ptr;
-            /* Neighbor and packet successfully allocated */
-            if(packetbuf_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS) == 0) {
-              /* Use default configuration for max transmissions */
-              metadata->max_transmissions = CSMA_MAX_MAC_TRANSMISSIONS;
-            } else {
-              metadata->max_transmissions =
-                  packetbuf_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS);
-            }
-            metadata->sent = sent;
-            metadata->cptr = ptr;
-
-            if(packetbuf_attr(PACKETBUF_ATTR_PACKET_TYPE) ==
-                PACKETBUF_ATTR_PACKET_TYPE_ACK) {
-              list_push(n->queued_packet_list, q);
-            } else {
-              list_add(n->queued_packet_list, q);
-            }
-
-            /* If q is the first packet in the neighbor's queue, send asap */
-            if(list_head(n->queued_packet_list) == q) {
-              ctimer_set(&n->transmit_timer, 0, transmit_packet_list, n);
-            }
-            return;
+    /* Add packet to the neighbor's queue */
+    q = memb_alloc(&packet_memb);
+    if(q != NULL) {
+      q->ptr = memb_alloc(&metadata_memb);
+      if(q->ptr != NULL) {
+        q->buf = queuebuf_new_from_packetbuf();
+        if(q->buf != NULL) {
+          struct qbuf_metadata *metadata = (struct qbuf_metadata *)q->ptr;
+          /* Neighbor and packet successfully allocated */
+          if(rimeaddr_cmp(addr, &rimeaddr_null)) {
+            /* Broadcasts are not acknowledged. */
+            metadata->max_transmissions = 1;
+          } else if(packetbuf_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS) == 0) {
+            /* Use default configuration for max transmissions */
+            metadata->max_transmissions = CSMA_MAX_MAC_TRANSMISSIONS;
+          } else {
+            metadata->max_transmissions =
+                packetbuf_attr(PACKETBUF_ATTR_MAX_MAC_TRANSMISSIONS);
           }
-          memb_free(&metadata_memb, q->ptr);
-          PRINTF("csma: could not allocate queuebuf, dropping packet\n");
+          metadata->sent = sent;
+          metadata->cptr = ptr;
+          metadata->priority = packet_priority();
+
+          enqueue(n, q);
+          csma_stats.enqueued++;
+
+          /* If q is the first packet in the neighbor's queue, send asap */
+          if(list_head(n->queued_packet_list) == q &&
+             list_item_next(q) == NULL) {
+            ctimer_set(&n->transmit_timer, 0, transmit_packet_list, n);
+          }
+          return;
         }
-        memb_free(&packet_memb, q);
+        memb_free(&metadata_memb, q->ptr);
         PRINTF("csma: could not allocate queuebuf, dropping packet\n");
       }
-      /* The packet allocation failed. Remove and free neighbor entry if empty. */
-      if(list_length(n->queued_packet_list) == 0) {
-        list_remove(neighbor_list, n);
-        memb_free(&neighbor_memb, n);
-      }
-      PRINTF("csma: could not allocate packet, dropping packet\n");
-    } else {
-      PRINTF("csma: could not allocate neighbor, dropping packet\n");
+      memb_free(&packet_memb, q);
+      PRINTF("csma: could not allocate queuebuf, dropping packet\n");
     }
-    mac_call_sent_callback(sent, ptr, MAC_TX_ERR, 1);
-  } else {
-    PRINTF("csma: send broadcast\n");
-#if CSMA_SHORTCUT
-    NETSTACK_RDC.send(packet_sent, ptr);
-    if(sent) {
-      sent(ptr, mac_status, 1);
+    /* The packet allocation failed. Remove and free neighbor entry if empty. */
+    if(list_length(n->queued_packet_list) == 0) {
+      free_neighbor_queue(n);
     }
-#else
-    NETSTACK_RDC.send(sent, ptr);
-#endif
+    PRINTF("csma: could not allocate packet, dropping packet\n");
+  } else {
+    PRINTF("csma: could not allocate neighbor, dropping packet\n");
+  }
+  csma_stats.drop_quota++;
+  mac_call_sent_callback(sent, ptr, MAC_TX_ERR, 1);
+}
+/*---------------------------------------------------------------------------*/
+int
+csma_queue_info(int index, struct csma_queue_info *info)
+{
+  struct neighbor_queue *n;
+  const struct link_stats *stats;
+
+  for(n = list_head(neighbor_list); n != NULL && index > 0;
+      n = list_item_next(n)) {
+    index--;
+  }
+  if(n == NULL) {
+    return 0;
   }
+  rimeaddr_copy(&info->addr, &n->addr);
+  info->packets = list_length(n->queued_packet_list);
+  info->quota = neighbor_quota(&n->addr);
+  stats = link_stats_from_lladdr(&n->addr);
+  info->noacks = stats != NULL ? stats->failures : 0;
+  return 1;
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -422,6 +692,7 @@ init(void)
   memb_init(&packet_memb);
   memb_init(&metadata_memb);
   memb_init(&neighbor_memb);
+  memset(&csma_stats, 0, sizeof(csma_stats));
 }
 /*---------------------------------------------------------------------------*/
 const struct mac_driver csma_driver = {
@@ -42,10 +42,46 @@
 #define __CSMA_H__
 
 #include "net/mac/mac.h"
+#include "net/rime/rimeaddr.h"
 #include "dev/radio.h"
 
 extern const struct mac_driver csma_driver;
 
+struct csma_stats {
+  uint16_t enqueued;
+  uint16_t sent;
+  /* Packets sent after the first packet of a burst, without waking
+     the receiver up again. */
+  uint16_t sent_in_burst;
+  /* Packets dropped because the neighbor queue was over its quota or
+     because no buffer was left. */
+  uint16_t drop_quota;
+  /* Packets dropped early for a neighbor that has not acknowledged
+     the last packets sent to it. */
+  uint16_t drop_aqm;
+  /* Packets dropped after the maximum number of transmissions. */
+  uint16_t drop_noack;
+};
+
+extern struct csma_stats csma_stats;
+
+struct csma_queue_info {
+  rimeaddr_t addr;
+  uint8_t packets;
+  uint8_t quota;
+  uint8_t noacks;
+};
+
+/**
+ * \brief      Get the state of a neighbor queue
+ * \param index The index of the queue, starting from zero
+ * \param info Filled in with the state of the queue
+ * \return     Zero if there is no queue with this index, non-zero otherwise
+ *
+ *             The broadcast queue has the null address.
+ */
+int csma_queue_info(int index, struct csma_queue_info *info);
+
 const struct mac_driver *csma_init(const struct mac_driver *r);
 
 #endif /* __CSMA_H__ */
@@ -65,84 +65,54 @@
 #include "net/mac/frame802154.h"
 #include <string.h>
 
-/**
- *  \brief Structure that contains the lengths of the various addressing and security fields
- *  in the 802.15.4 header.  This structure is used in \ref frame802154_create()
- */
-typedef struct {
-  uint8_t dest_pid_len;    /**<  Length (in bytes) of destination PAN ID field */
-  uint8_t dest_addr_len;   /**<  Length (in bytes) of destination address field */
-  uint8_t src_pid_len;     /**<  Length (in bytes) of source PAN ID field */
-  uint8_t src_addr_len;    /**<  Length (in bytes) of source address field */
-  uint8_t aux_sec_len;     /**<  Length (in bytes) of aux security header field */
-} field_length_t;
+#define PID_LEN(mode)  ((mode) != 0 ? 2 : 0)
+#define ADDR_LEN(mode) ((mode) == FRAME802154_SHORTADDRMODE ? 2 : \
+                        (mode) == FRAME802154_LONGADDRMODE ? 8 : 0)
 
-static field_length_t flen;
-static frame802154_fcf_t fcf;
-/*----------------------------------------------------------------------------*/
-CC_INLINE static uint8_t
-addr_len(uint8_t mode)
-{
-  switch(mode) {
-  case FRAME802154_SHORTADDRMODE:  /* 16-bit address */
-    return 2;
-  case FRAME802154_LONGADDRMODE:   /* 64-bit address */
-    return 8;
-  default:
-    return 0;
-  }
-}
-/*----------------------------------------------------------------------------*/
-static void
-field_len(frame802154_t *p, field_length_t *flen)
-{
-  /* init flen to zeros */
-  memset(flen, 0, sizeof(field_length_t));
+#define DEST_ADDR_OFFSET(d)       (3 + PID_LEN(d))
+#define SRC_PID_OFFSET(d)         (DEST_ADDR_OFFSET(d) + ADDR_LEN(d))
+#define SRC_ADDR_OFFSET(d, s, c)  (SRC_PID_OFFSET(d) + ((c) ? 0 : PID_LEN(s)))
 
-  /* Determine lengths of each field based on fcf and other args */
-  if(p->fcf.dest_addr_mode & 3) {
-    flen->dest_pid_len = 2;
-  }
-  if(p->fcf.src_addr_mode & 3) {
-    flen->src_pid_len = 2;
-  }
+#define LAYOUT(d, s, c) { DEST_ADDR_OFFSET(d), SRC_PID_OFFSET(d), \
+      SRC_ADDR_OFFSET(d, s, c), SRC_ADDR_OFFSET(d, s, c) + ADDR_LEN(s) }
 
+/* Indexed with FRAME802154_LAYOUT_INDEX(): destination address mode,
+   source address mode and PAN ID compression bit, lowest bits first. */
+const frame802154_layout_t frame802154_layouts[32] = {
+  LAYOUT(0, 0, 0), LAYOUT(1, 0, 0), LAYOUT(2, 0, 0), LAYOUT(3, 0, 0),
+  LAYOUT(0, 1, 0), LAYOUT(1, 1, 0), LAYOUT(2, 1, 0), LAYOUT(3, 1, 0),
+  LAYOUT(0, 2, 0), LAYOUT(1, 2, 0), LAYOUT(2, 2, 0), LAYOUT(3, 2, 0),
+  LAYOUT(0, 3, 0), LAYOUT(1, 3, 0), LAYOUT(2, 3, 0), LAYOUT(3, 3, 0),
+  LAYOUT(0, 0, 1), LAYOUT(1, 0, 1), LAYOUT(2, 0, 1), LAYOUT(3, 0, 1),
+  LAYOUT(0, 1, 1), LAYOUT(1, 1, 1), LAYOUT(2, 1, 1), LAYOUT(3, 1, 1),
+  LAYOUT(0, 2, 1), LAYOUT(1, 2, 1), LAYOUT(2, 2, 1), LAYOUT(3, 2, 1),
+  LAYOUT(0, 3, 1), LAYOUT(1, 3, 1), LAYOUT(2, 3, 1), LAYOUT(3, 3, 1)
+};
+/*----------------------------------------------------------------------------*/
+static const frame802154_layout_t *
+layout(frame802154_t *p)
+{
   /* Set PAN ID compression bit if src pan id matches dest pan id. */
   if(p->fcf.dest_addr_mode & 3 && p->fcf.src_addr_mode & 3 &&
      p->src_pid == p->dest_pid) {
     p->fcf.panid_compression = 1;
-
-    /* compressed header, only do dest pid */
-    flen->src_pid_len = 0;
   } else {
     p->fcf.panid_compression = 0;
   }
 
-  /* determine address lengths */
-  flen->dest_addr_len = addr_len(p->fcf.dest_addr_mode & 3);
-  flen->src_addr_len = addr_len(p->fcf.src_addr_mode & 3);
+  /* TODO Aux security header not yet implemented */
 
-  /* Aux security header */
-  if(p->fcf.security_enabled & 1) {
-    /* TODO Aux security header not yet implemented */
-#if 0
-    switch(p->aux_hdr.security_control.key_id_mode) {
-    case 0:
-      flen->aux_sec_len = 5; /* minimum value */
-      break;
-    case 1:
-      flen->aux_sec_len = 6;
-      break;
-    case 2:
-      flen->aux_sec_len = 10;
-      break;
-    case 3:
-      flen->aux_sec_len = 14;
-      break;
-    default:
-      break;
-    }
-#endif
+  return &frame802154_layouts[(p->fcf.dest_addr_mode & 3) |
+                              ((p->fcf.src_addr_mode & 3) << 2) |
+                              (p->fcf.panid_compression << 4)];
+}
+/*----------------------------------------------------------------------------*/
+static void
+copy_addr(uint8_t *dest, const uint8_t *src, uint8_t len)
+{
+  /* Addresses are sent least significant byte first. */
+  while(len > 0) {
+    *dest++ = src[--len];
   }
 }
 /*----------------------------------------------------------------------------*/
@@ -158,9 +128,7 @@ field_len(frame802154_t *p, field_length_t *flen)
 uint8_t
 frame802154_hdrlen(frame802154_t *p)
 {
-  field_len(p, &flen);
-  return 3 + flen.dest_pid_len + flen.dest_addr_len +
-    flen.src_pid_len + flen.src_addr_len + flen.aux_sec_len;
+  return layout(p)->hdr_len;
 }
 /*----------------------------------------------------------------------------*/
 /**
@@ -180,63 +148,41 @@ frame802154_hdrlen(frame802154_t *p)
 uint8_t
 frame802154_create(frame802154_t *p, uint8_t *buf, uint8_t buf_len)
 {
-  int c;
-  uint8_t *tx_frame_buffer;
-  uint8_t pos;
-
-  field_len(p, &flen);
+  const frame802154_layout_t *l;
 
-  if(3 + flen.dest_pid_len + flen.dest_addr_len +
-     flen.src_pid_len + flen.src_addr_len + flen.aux_sec_len > buf_len) {
+  l = layout(p);
+  if(l->hdr_len > buf_len) {
     /* Too little space for headers. */
     return 0;
   }
 
-  /* OK, now we have field lengths.  Time to actually construct */
-  /* the outgoing frame, and store it in tx_frame_buffer */
-  tx_frame_buffer = buf;
-  tx_frame_buffer[0] = (p->fcf.frame_type & 7) |
+  buf[0] = (p->fcf.frame_type & 7) |
     ((p->fcf.security_enabled & 1) << 3) |
     ((p->fcf.frame_pending & 1) << 4) |
     ((p->fcf.ack_required & 1) << 5) |
     ((p->fcf.panid_compression & 1) << 6);
-  tx_frame_buffer[1] = ((p->fcf.dest_addr_mode & 3) << 2) |
+  buf[1] = ((p->fcf.dest_addr_mode & 3) << 2) |
     ((p->fcf.frame_version & 3) << 4) |
     ((p->fcf.src_addr_mode & 3) << 6);
 
   /* sequence number */
-  tx_frame_buffer[2] = p->seq;
-  pos = 3;
-
-  /* Destination PAN ID */
-  if(flen.dest_pid_len == 2) {
-    tx_frame_buffer[pos++] = p->dest_pid & 0xff;
-    tx_frame_buffer[pos++] = (p->dest_pid >> 8) & 0xff;
-  }
-
-  /* Destination address */
-  for(c = flen.dest_addr_len; c > 0; c--) {
-    tx_frame_buffer[pos++] = p->dest_addr[c - 1];
-  }
-
-  /* Source PAN ID */
-  if(flen.src_pid_len == 2) {
-    tx_frame_buffer[pos++] = p->src_pid & 0xff;
-    tx_frame_buffer[pos++] = (p->src_pid >> 8) & 0xff;
-  }
+  buf[2] = p->seq;
 
-  /* Source address */
-  for(c = flen.src_addr_len; c > 0; c--) {
-    tx_frame_buffer[pos++] = p->src_addr[c - 1];
+  if(p->fcf.dest_addr_mode & 3) {
+    buf[3] = p->dest_pid & 0xff;
+    buf[4] = (p->dest_pid >> 8) & 0xff;
+    copy_addr(&buf[l->dest_addr_offset], p->dest_addr,
+              l->src_pid_offset - l->dest_addr_offset);
   }
 
-  /* Aux header */
-  if(flen.aux_sec_len) {
-    /* TODO Aux security header not yet implemented */
-/*     pos += flen.aux_sec_len; */
+  if(l->src_pid_offset != l->src_addr_offset) {
+    buf[l->src_pid_offset] = p->src_pid & 0xff;
+    buf[l->src_pid_offset + 1] = (p->src_pid >> 8) & 0xff;
   }
+  copy_addr(&buf[l->src_addr_offset], p->src_addr,
+            l->hdr_len - l->src_addr_offset);
 
-  return pos;
+  return l->hdr_len;
 }
 /*----------------------------------------------------------------------------*/
 /**
@@ -247,109 +193,75 @@ frame802154_create(frame802154_t *p, uint8_t *buf, uint8_t buf_len)
  *   \param data The input data from the radio chip.
  *   \param len The size of the input data
  *   \param pf The frame802154_t struct to store the parsed frame information.
+ *
+ *   \return The length of the frame header, or 0 if the frame is
+ *   too short to hold the header.
  */
 uint8_t
 frame802154_parse(uint8_t *data, uint8_t len, frame802154_t *pf)
 {
+  const frame802154_layout_t *l;
   uint8_t *p;
-  uint8_t c;
 
   if(len < 3) {
     return 0;
   }
 
   p = data;
+  l = frame802154_layout(p[0], p[1]);
+  if(l->hdr_len > len) {
+    return 0;
+  }
 
-  memset(&fcf, 0, sizeof(fcf));
   /* decode the FCF */
-  fcf.frame_type = p[0] & 7;
-  fcf.security_enabled = (p[0] >> 3) & 1;
-  fcf.frame_pending = (p[0] >> 4) & 1;
-  fcf.ack_required = (p[0] >> 5) & 1;
-  fcf.panid_compression = (p[0] >> 6) & 1;
+  pf->fcf.frame_type = p[0] & 7;
+  pf->fcf.security_enabled = (p[0] >> 3) & 1;
+  pf->fcf.frame_pending = (p[0] >> 4) & 1;
+  pf->fcf.ack_required = (p[0] >> 5) & 1;
+  pf->fcf.panid_compression = (p[0] >> 6) & 1;
 
-  fcf.dest_addr_mode = (p[1] >> 2) & 3;
-  fcf.frame_version = (p[1] >> 4) & 3;
-  fcf.src_addr_mode = (p[1] >> 6) & 3;
+  pf->fcf.dest_addr_mode = (p[1] >> 2) & 3;
+  pf->fcf.frame_version = (p[1] >> 4) & 3;
+  pf->fcf.src_addr_mode = (p[1] >> 6) & 3;
 
-  /* copy fcf and seqNum */
-  memcpy(&pf->fcf, &fcf, sizeof(frame802154_fcf_t));
   pf->seq = p[2];
-  p += 3;                             /* Skip first three bytes */
 
-  /* Destination address, if any */
-  if(fcf.dest_addr_mode) {
-    /* Destination PAN */
-    pf->dest_pid = p[0] + (p[1] << 8);
-    p += 2;
+  memset(pf->dest_addr, 0, sizeof(pf->dest_addr));
+  memset(pf->src_addr, 0, sizeof(pf->src_addr));
 
-    /* Destination address */
-/*     l = addr_len(fcf.dest_addr_mode); */
-/*     for(c = 0; c < l; c++) { */
-/*       pf->dest_addr.u8[c] = p[l - c - 1]; */
-/*     } */
-/*     p += l; */
-    if(fcf.dest_addr_mode == FRAME802154_SHORTADDRMODE) {
-      rimeaddr_copy((rimeaddr_t *)&(pf->dest_addr), &rimeaddr_null);
-      pf->dest_addr[0] = p[1];
-      pf->dest_addr[1] = p[0];
-      p += 2;
-    } else if(fcf.dest_addr_mode == FRAME802154_LONGADDRMODE) {
-      for(c = 0; c < 8; c++) {
-        pf->dest_addr[c] = p[7 - c];
-      }
-      p += 8;
-    }
+  /* Destination address, if any */
+  if(pf->fcf.dest_addr_mode) {
+    pf->dest_pid = p[3] + (p[4] << 8);
+    copy_addr(pf->dest_addr, &p[l->dest_addr_offset],
+              l->src_pid_offset - l->dest_addr_offset);
   } else {
-    rimeaddr_copy((rimeaddr_t *)&(pf->dest_addr), &rimeaddr_null);
     pf->dest_pid = 0;
   }
 
   /* Source address, if any */
-  if(fcf.src_addr_mode) {
-    /* Source PAN */
-    if(!fcf.panid_compression) {
-      pf->src_pid = p[0] + (p[1] << 8);
-      p += 2;
+  if(pf->fcf.src_addr_mode) {
+    if(l->src_pid_offset != l->src_addr_offset) {
+      pf->src_pid = p[l->src_pid_offset] + (p[l->src_pid_offset + 1] << 8);
     } else {
       pf->src_pid = pf->dest_pid;
     }
-
-    /* Source address */
-/*     l = addr_len(fcf.src_addr_mode); */
-/*     for(c = 0; c < l; c++) { */
-/*       pf->src_addr.u8[c] = p[l - c - 1]; */
-/*     } */
-/*     p += l; */
-    if(fcf.src_addr_mode == FRAME802154_SHORTADDRMODE) {
-      rimeaddr_copy((rimeaddr_t *)&(pf->src_addr), &rimeaddr_null);
-      pf->src_addr[0] = p[1];
-      pf->src_addr[1] = p[0];
-      p += 2;
-    } else if(fcf.src_addr_mode == FRAME802154_LONGADDRMODE) {
-      for(c = 0; c < 8; c++) {
-        pf->src_addr[c] = p[7 - c];
-      }
-      p += 8;
-    }
+    copy_addr(pf->src_addr, &p[l->src_addr_offset],
+              l->hdr_len - l->src_addr_offset);
   } else {
-    rimeaddr_copy((rimeaddr_t *)&(pf->src_addr), &rimeaddr_null);
     pf->src_pid = 0;
   }
 
-  if(fcf.security_enabled) {
+  if(pf->fcf.security_enabled) {
     /* TODO aux security header, not yet implemented */
 /*     return 0; */
   }
 
-  /* header length */
-  c = p - data;
   /* payload length */
-  pf->payload_len = len - c;
+  pf->payload_len = len - l->hdr_len;
   /* payload */
-  pf->payload = p;
+  pf->payload = p + l->hdr_len;
 
   /* return header length if successful */
-  return c > len ? 0 : c;
+  return l->hdr_len;
 }
 /** \}   */
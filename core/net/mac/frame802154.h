@@ -158,6 +158,34 @@ typedef struct {
   uint8_t payload_len;  /**< Length of payload field */
 } frame802154_t;
 
+/**
+ * \brief The positions of the addressing fields in a frame header.
+ *
+ *  The layout only depends on the address modes and the PAN ID
+ *  compression bit of the FCF, so it is looked up in a table instead
+ *  of being worked out field by field. A frame has a destination PAN
+ *  ID at offset 3 if its destination address mode is non-zero, and a
+ *  source PAN ID if src_pid_offset differs from src_addr_offset.
+ */
+typedef struct {
+  uint8_t dest_addr_offset; /**< Offset of the destination address */
+  uint8_t src_pid_offset;   /**< Offset of the source PAN ID */
+  uint8_t src_addr_offset;  /**< Offset of the source address */
+  uint8_t hdr_len;          /**< Length of the header */
+} frame802154_layout_t;
+
+/** \brief The table index of the layout of a frame with the FCF bytes
+    fcf0 and fcf1. */
+#define FRAME802154_LAYOUT_INDEX(fcf0, fcf1) \
+  ((((fcf1) >> 2) & 3) | (((fcf1) >> 4) & 0x0c) | (((fcf0) >> 2) & 0x10))
+
+extern const frame802154_layout_t frame802154_layouts[32];
+
+/** \brief The layout of the frame header that starts with the FCF bytes
+    fcf0 and fcf1. */
+#define frame802154_layout(fcf0, fcf1) \
+  (&frame802154_layouts[FRAME802154_LAYOUT_INDEX(fcf0, fcf1)])
+
 /* Prototypes */
 
 uint8_t frame802154_hdrlen(frame802154_t *p);
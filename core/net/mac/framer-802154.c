@@ -53,6 +53,30 @@
 #define PRINTADDR(addr)
 #endif
 
+/* Drop unicast frames for other nodes before they are copied into
+   the packetbuf attributes. This is off by default, because the
+   radio duty cycling layers look at frames that are not for them:
+   X-MAC and CX-MAC keep the radio on while someone else is sending,
+   and ContikiMAC refreshes the phase of the sender. With nullrdc, a
+   platform may turn it on to drop such frames earlier. */
+#ifdef FRAMER_802154_CONF_ADDRESS_FILTER
+#define FRAMER_802154_ADDRESS_FILTER FRAMER_802154_CONF_ADDRESS_FILTER
+#else
+#define FRAMER_802154_ADDRESS_FILTER 0
+#endif /* FRAMER_802154_CONF_ADDRESS_FILTER */
+
+/**
+   \todo For phase 1 the addresses are all long. We'll need a mechanism
+   in the rime attributes to tell the mac to use long or short for phase 2.
+*/
+#if (RIMEADDR_SIZE == 2)
+#define ADDR_MODE FRAME802154_SHORTADDRMODE
+#define ADDR_LEN  2
+#else
+#define ADDR_MODE FRAME802154_LONGADDRMODE
+#define ADDR_LEN  8
+#endif
+
 /**  \brief The sequence number (0x00 - 0xff) added to the transmitted
  *   data or MAC command frame. The default is a random value within
  *   the range.
@@ -60,146 +84,164 @@
 static uint8_t mac_dsn;
 
 static uint8_t initialized = 0;
-
-static frame802154_t frame;
-static uint8_t len;
 /*---------------------------------------------------------------------------*/
 static int
-is_broadcast_addr(uint8_t mode, uint8_t *addr)
+is_broadcast_addr(const uint8_t *addr, uint8_t len)
 {
-  int i = mode == FRAME802154_SHORTADDRMODE ? 2 : 8;
-  while(i-- > 0) {
-    if(addr[i] != 0xff) {
+  while(len-- > 0) {
+    if(addr[len] != 0xff) {
       return 0;
     }
   }
   return 1;
 }
 /*---------------------------------------------------------------------------*/
+static void
+get_addr(rimeaddr_t *addr, const uint8_t *field, uint8_t len)
+{
+  uint8_t i;
+
+  /* Addresses are sent least significant byte first. */
+  rimeaddr_copy(addr, &rimeaddr_null);
+  for(i = 0; i < len && i < RIMEADDR_SIZE; i++) {
+    addr->u8[i] = field[len - 1 - i];
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_addr(uint8_t *field, const rimeaddr_t *addr)
+{
+  uint8_t i;
+
+  for(i = 0; i < ADDR_LEN; i++) {
+    field[ADDR_LEN - 1 - i] = i < RIMEADDR_SIZE ? addr->u8[i] : 0;
+  }
+}
+/*---------------------------------------------------------------------------*/
 static int
 create(void)
 {
-
-  /* init to zeros */
-  memset(&frame, 0, sizeof(frame));
+  const frame802154_layout_t *l;
+  uint8_t *hdr;
+  uint8_t fcf0, fcf1, seq;
+  int broadcast;
 
   if(!initialized) {
     initialized = 1;
     mac_dsn = random_rand() & 0xff;
   }
 
-  /* Build the FCF. */
-  frame.fcf.frame_type = FRAME802154_DATAFRAME;
-  frame.fcf.security_enabled = 0;
-  frame.fcf.frame_pending = packetbuf_attr(PACKETBUF_ATTR_PENDING);
-  if(rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER), &rimeaddr_null)) {
-    frame.fcf.ack_required = 0;
-  } else {
-    frame.fcf.ack_required = packetbuf_attr(PACKETBUF_ATTR_MAC_ACK);
-  }
-  frame.fcf.panid_compression = 0;
-
-  /* Insert IEEE 802.15.4 (2003) version bit. */
-  frame.fcf.frame_version = FRAME802154_IEEE802154_2003;
-
   /* Increment and set the data sequence number. */
   if(packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO)) {
-    frame.seq = packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO);
+    seq = packetbuf_attr(PACKETBUF_ATTR_MAC_SEQNO);
   } else {
-    frame.seq = mac_dsn++;
-    packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, frame.seq);
+    seq = mac_dsn++;
+    packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, seq);
   }
-/*   params.seq = packetbuf_attr(PACKETBUF_ATTR_PACKET_ID); */
-
-  /* Complete the addressing fields. */
-  /**
-     \todo For phase 1 the addresses are all long. We'll need a mechanism
-     in the rime attributes to tell the mac to use long or short for phase 2.
-  */
-#if (RIMEADDR_SIZE == 2)
-  frame.fcf.src_addr_mode = FRAME802154_SHORTADDRMODE;
-#else
-  frame.fcf.src_addr_mode = FRAME802154_LONGADDRMODE;
-#endif
-  frame.dest_pid = IEEE802154_PANID;
 
   /*
    *  If the output address is NULL in the Rime buf, then it is broadcast
    *  on the 802.15.4 network.
    */
-  if(rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER), &rimeaddr_null)) {
-    /* Broadcast requires short address mode. */
-    frame.fcf.dest_addr_mode = FRAME802154_SHORTADDRMODE;
-    frame.dest_addr[0] = 0xFF;
-    frame.dest_addr[1] = 0xFF;
+  broadcast = rimeaddr_cmp(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
+                           &rimeaddr_null);
+
+  /* Build the FCF. Both PAN IDs are IEEE802154_PANID, so the source
+     PAN ID is always compressed away. Broadcast requires short
+     address mode. */
+  fcf0 = FRAME802154_DATAFRAME |
+    ((packetbuf_attr(PACKETBUF_ATTR_PENDING) & 1) << 4) |
+    (broadcast ? 0 : (packetbuf_attr(PACKETBUF_ATTR_MAC_ACK) & 1) << 5) |
+    (1 << 6);
+  fcf1 = ((broadcast ? FRAME802154_SHORTADDRMODE : ADDR_MODE) << 2) |
+    (FRAME802154_IEEE802154_2003 << 4) |
+    (ADDR_MODE << 6);
+
+  l = frame802154_layout(fcf0, fcf1);
+  if(!packetbuf_hdralloc(l->hdr_len)) {
+    PRINTF("15.4-OUT: too large header: %u\n", l->hdr_len);
+    return FRAMER_FAILED;
+  }
 
+  /* The header is written directly into the packetbuf header area. */
+  hdr = packetbuf_hdrptr();
+  hdr[0] = fcf0;
+  hdr[1] = fcf1;
+  hdr[2] = seq;
+  hdr[3] = IEEE802154_PANID & 0xff;
+  hdr[4] = (IEEE802154_PANID >> 8) & 0xff;
+  if(broadcast) {
+    hdr[l->dest_addr_offset] = 0xff;
+    hdr[l->dest_addr_offset + 1] = 0xff;
   } else {
-    rimeaddr_copy((rimeaddr_t *)&frame.dest_addr,
-        packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
-    /* Use short address mode if rimeaddr size is small */
-#if (RIMEADDR_SIZE == 2)
-    frame.fcf.dest_addr_mode = FRAME802154_SHORTADDRMODE;
-#else
-    frame.fcf.dest_addr_mode = FRAME802154_LONGADDRMODE;
-#endif
+    put_addr(&hdr[l->dest_addr_offset],
+             packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
   }
+  put_addr(&hdr[l->src_addr_offset], &rimeaddr_node_addr);
 
-  /* Set the source PAN ID to the global variable. */
-  frame.src_pid = IEEE802154_PANID;
+  PRINTF("15.4-OUT: %2X", FRAME802154_DATAFRAME);
+  PRINTADDR(packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+  PRINTF("%u %u (%u)\n", l->hdr_len, packetbuf_datalen(), packetbuf_totlen());
 
-  /*
-   * Set up the source address using only the long address mode for
-   * phase 1.
-   */
-  rimeaddr_copy((rimeaddr_t *)&frame.src_addr, &rimeaddr_node_addr);
-
-  frame.payload = packetbuf_dataptr();
-  frame.payload_len = packetbuf_datalen();
-  len = frame802154_hdrlen(&frame);
-  if(packetbuf_hdralloc(len)) {
-    frame802154_create(&frame, packetbuf_hdrptr(), len);
-
-    PRINTF("15.4-OUT: %2X", frame.fcf.frame_type);
-    PRINTADDR(frame.dest_addr.u8);
-    PRINTF("%u %u (%u)\n", len, packetbuf_datalen(), packetbuf_totlen());
-
-    return len;
-  } else {
-    PRINTF("15.4-OUT: too large header: %u\n", len);
-    return FRAMER_FAILED;
-  }
+  return l->hdr_len;
 }
 /*---------------------------------------------------------------------------*/
 static int
 parse(void)
 {
+  const frame802154_layout_t *l;
+  rimeaddr_t addr;
+  uint8_t *hdr;
+  uint8_t len;
+  uint16_t pid;
+
+  hdr = packetbuf_dataptr();
   len = packetbuf_datalen();
-  if(frame802154_parse(packetbuf_dataptr(), len, &frame) &&
-     packetbuf_hdrreduce(len - frame.payload_len)) {
-    if(frame.fcf.dest_addr_mode) {
-      if(frame.dest_pid != IEEE802154_PANID &&
-         frame.dest_pid != FRAME802154_BROADCASTPANDID) {
-        /* Packet to another PAN */
-        PRINTF("15.4: for another pan %u\n", frame.dest_pid);
+  if(len < 3) {
+    return FRAMER_FAILED;
+  }
+  l = frame802154_layout(hdr[0], hdr[1]);
+  if(l->hdr_len > len) {
+    return FRAMER_FAILED;
+  }
+
+  /* The addressing fields are checked where they are in the frame,
+     so that frames for other PANs and nodes are dropped before
+     anything is copied out of them. */
+  if((hdr[1] >> 2) & 3) {
+    pid = hdr[3] + (hdr[4] << 8);
+    if(pid != IEEE802154_PANID && pid != FRAME802154_BROADCASTPANDID) {
+      /* Packet to another PAN */
+      PRINTF("15.4: for another pan %u\n", pid);
+      return FRAMER_FAILED;
+    }
+    if(!is_broadcast_addr(&hdr[l->dest_addr_offset],
+                          l->src_pid_offset - l->dest_addr_offset)) {
+      get_addr(&addr, &hdr[l->dest_addr_offset],
+               l->src_pid_offset - l->dest_addr_offset);
+#if FRAMER_802154_ADDRESS_FILTER
+      if(!rimeaddr_cmp(&addr, &rimeaddr_node_addr)) {
+        PRINTF("15.4: not for us\n");
         return FRAMER_FAILED;
       }
-      if(!is_broadcast_addr(frame.fcf.dest_addr_mode, frame.dest_addr)) {
-        packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, (rimeaddr_t *)&frame.dest_addr);
-      }
+#endif /* FRAMER_802154_ADDRESS_FILTER */
+      packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &addr);
     }
-    packetbuf_set_addr(PACKETBUF_ADDR_SENDER, (rimeaddr_t *)&frame.src_addr);
-    packetbuf_set_attr(PACKETBUF_ATTR_PENDING, frame.fcf.frame_pending);
-    /*    packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, frame.fcf.ack_required);*/
-    packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, frame.seq);
+  }
+  get_addr(&addr, &hdr[l->src_addr_offset], l->hdr_len - l->src_addr_offset);
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &addr);
+  packetbuf_set_attr(PACKETBUF_ATTR_PENDING, (hdr[0] >> 4) & 1);
+  /*    packetbuf_set_attr(PACKETBUF_ATTR_RELIABLE, (hdr[0] >> 5) & 1);*/
+  packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, hdr[2]);
 
-    PRINTF("15.4-IN: %2X", frame.fcf.frame_type);
-    PRINTADDR(packetbuf_addr(PACKETBUF_ADDR_SENDER));
-    PRINTADDR(packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
-    PRINTF("%u (%u)\n", packetbuf_datalen(), len);
+  packetbuf_hdrreduce(l->hdr_len);
 
-    return len - frame.payload_len;
-  }
-  return FRAMER_FAILED;
+  PRINTF("15.4-IN: %2X", hdr[0] & 7);
+  PRINTADDR(packetbuf_addr(PACKETBUF_ADDR_SENDER));
+  PRINTADDR(packetbuf_addr(PACKETBUF_ADDR_RECEIVER));
+  PRINTF("%u (%u)\n", packetbuf_datalen(), len);
+
+  return l->hdr_len;
 }
 /*---------------------------------------------------------------------------*/
 const struct framer framer_802154 = {
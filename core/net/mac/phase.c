@@ -46,6 +46,8 @@
 #include "dev/watchdog.h"
 #include "dev/leds.h"
 
+#include <string.h>
+
 struct phase_queueitem {
   struct ctimer timer;
   mac_callback_t mac_callback;
@@ -61,6 +63,16 @@ struct phase_queueitem {
 
 #define MAX_NOACKS_TIME       CLOCK_SECOND * 30
 
+/* Wake-ups that are older than this are not used to predict the next
+   one. It must be well below the wrap-around time of clock_time(). */
+#define MAX_SAMPLE_AGE        (CLOCK_SECOND * 60)
+
+/* The largest number of cycles between the wake-ups that the skew is
+   estimated from. */
+#define MAX_SAMPLE_CYCLES     1024
+
+#define NO_ESTIMATE           0xffff
+
 MEMB(queued_packets_memb, struct phase_queueitem, PHASE_QUEUESIZE);
 
 #define DEBUG 0
@@ -73,11 +85,24 @@ MEMB(queued_packets_memb, struct phase_queueitem, PHASE_QUEUESIZE);
 #define PRINTDEBUG(...)
 #endif
 /*---------------------------------------------------------------------------*/
-struct phase *
+static struct phase **
+bucket(const struct phase_list *list, const rimeaddr_t *addr)
+{
+  uint8_t h;
+  int i;
+
+  h = 0;
+  for(i = 0; i < sizeof(rimeaddr_t); i++) {
+    h ^= addr->u8[i];
+  }
+  return &list->hash[h & (PHASE_HASH_SIZE - 1)];
+}
+/*---------------------------------------------------------------------------*/
+static struct phase *
 find_neighbor(const struct phase_list *list, const rimeaddr_t *addr)
 {
   struct phase *e;
-  for(e = list_head(*list->list); e != NULL; e = list_item_next(e)) {
+  for(e = *bucket(list, addr); e != NULL; e = e->hash_next) {
     if(rimeaddr_cmp(addr, &e->neighbor)) {
       return e;
     }
@@ -85,21 +110,223 @@ find_neighbor(const struct phase_list *list, const rimeaddr_t *addr)
   return NULL;
 }
 /*---------------------------------------------------------------------------*/
+static void
+remove_neighbor(const struct phase_list *list, struct phase *e)
+{
+  struct phase **p;
+
+  for(p = bucket(list, &e->neighbor); *p != NULL; p = &(*p)->hash_next) {
+    if(*p == e) {
+      *p = e->hash_next;
+      break;
+    }
+  }
+  list_remove(*list->list, e);
+  memb_free(list->memb, e);
+}
+/*---------------------------------------------------------------------------*/
+static struct phase *
+add_neighbor(const struct phase_list *list, const rimeaddr_t *addr)
+{
+  struct phase *e;
+  struct phase **b;
+
+  e = memb_alloc(list->memb);
+  if(e == NULL) {
+    PRINTF("phase alloc NULL\n");
+    /* We could not allocate memory for this phase, so we drop the
+       neighbor that we have not heard from for the longest time and
+       reuse its entry. */
+    e = list_tail(*list->list);
+    if(e == NULL) {
+      return NULL;
+    }
+    remove_neighbor(list, e);
+    e = memb_alloc(list->memb);
+  }
+  rimeaddr_copy(&e->neighbor, addr);
+  b = bucket(list, addr);
+  e->hash_next = *b;
+  *b = e;
+  list_push(*list->list, e);
+  return e;
+}
+/*---------------------------------------------------------------------------*/
 void
 phase_remove(const struct phase_list *list, const rimeaddr_t *neighbor)
 {
   struct phase *e;
   e = find_neighbor(list, neighbor);
   if(e != NULL) {
+    remove_neighbor(list, e);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+phase_refresh(const struct phase_list *list, const rimeaddr_t *neighbor)
+{
+  struct phase *e;
+
+  /* Keep the neighbors that we hear from first in the list, so that
+     they are the last ones to be replaced. */
+  e = find_neighbor(list, neighbor);
+  if(e != NULL && e != list_head(*list->list)) {
     list_remove(*list->list, e);
-    memb_free(list->memb, e);
+    list_push(*list->list, e);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+phase_set_cycle_shift(const struct phase_list *list,
+                      const rimeaddr_t *neighbor, uint8_t cycle_shift)
+{
+  struct phase *e;
+
+  e = find_neighbor(list, neighbor);
+  if(e == NULL) {
+    return;
+  }
+  if(cycle_shift < e->cycle_shift) {
+    /* The latest wake-up that we know of may have been one of the
+       channel checks that the neighbor no longer does. */
+    remove_neighbor(list, e);
+  } else {
+    e->cycle_shift = cycle_shift;
+  }
+}
+/*---------------------------------------------------------------------------*/
+#if PHASE_DRIFT_CORRECT
+/*
+ * Returns the time from the latest wake-up of a neighbor to now, in
+ * rtimer ticks, or -1 if it was too long ago. The difference in
+ * clock_time() gives an estimate that is only a few clock ticks off,
+ * and the difference in rtimer time gives the exact value.
+ */
+static int32_t
+elapsed(const struct phase *e, rtimer_clock_t now)
+{
+  clock_time_t age;
+  uint32_t coarse;
+  rtimer_clock_t estimate;
+
+  age = clock_time() - e->clock;
+  if(age > MAX_SAMPLE_AGE) {
+    return -1;
+  }
+  coarse = (uint32_t)age * (RTIMER_ARCH_SECOND / CLOCK_SECOND) +
+    (uint32_t)age * (RTIMER_ARCH_SECOND % CLOCK_SECOND) / CLOCK_SECOND;
+  estimate = e->time + (rtimer_clock_t)coarse;
+  if(RTIMER_CLOCK_LT(now, estimate)) {
+    return (int32_t)coarse - (rtimer_clock_t)(estimate - now);
+  }
+  return (int32_t)coarse + (rtimer_clock_t)(now - estimate);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Estimates the clock skew of a neighbor with a least squares fit of
+ * the offsets of its earlier wake-ups, through its latest wake-up.
+ */
+static void
+estimate_skew(struct phase *e)
+{
+  int32_t num, den;
+  int i;
+
+  num = den = 0;
+  for(i = 0; i < e->samples; i++) {
+    num -= (int32_t)e->history[i].cycles * e->history[i].offset;
+    den += (int32_t)e->history[i].cycles * e->history[i].cycles;
+  }
+  /* Scale down so that the skew can be computed in 1/256 ticks. */
+  while(num > 0x7fffffL || num < -0x7fffffL) {
+    num /= 2;
+    den /= 2;
+  }
+  if(den == 0) {
+    e->skew = 0;
+    return;
   }
+  num = num * 256 / den;
+  if(num > 0x7fff) {
+    num = 0x7fff;
+  } else if(num < -0x7fff) {
+    num = -0x7fff;
+  }
+  e->skew = num;
+}
+/*---------------------------------------------------------------------------*/
+static void
+reset_samples(struct phase *e)
+{
+  e->samples = 0;
+  e->skew = 0;
+  e->error = NO_ESTIMATE;
 }
 /*---------------------------------------------------------------------------*/
+static void
+add_sample(struct phase *e, rtimer_clock_t time, rtimer_clock_t cycle_time)
+{
+  int32_t t, offset, error;
+  rtimer_clock_t check_time;
+  uint16_t checks, cycles;
+  int i, j;
+
+  t = elapsed(e, time);
+  if(t < 0 || t / cycle_time >= MAX_SAMPLE_CYCLES) {
+    reset_samples(e);
+    return;
+  }
+  /* A neighbor that checks the channel more than once per cycle does
+     so at the same phase, so the offset is taken from the nearest
+     channel check. */
+  check_time = cycle_time >> e->cycle_shift;
+  checks = (t + check_time / 2) / check_time;
+  cycles = (checks + (1 << e->cycle_shift) / 2) >> e->cycle_shift;
+  if(cycles == 0) {
+    /* Too close to the latest wake-up to tell the skew. */
+    return;
+  }
+  offset = t - (int32_t)checks * check_time;
+  error = offset - (int32_t)cycles * e->skew / 256;
+  if(error < 0) {
+    error = -error;
+  }
+  if(error > check_time / 8) {
+    /* The neighbor has changed its phase, for example by rebooting. */
+    PRINTF("phase reset %d.%d error %ld\n", e->neighbor.u8[0],
+           e->neighbor.u8[1], (long)error);
+    reset_samples(e);
+    return;
+  }
+  e->error = error;
+
+  /* Make the earlier wake-ups relative to the new one, and drop the
+     ones that are too old. */
+  for(i = 0, j = 0; i < e->samples; i++) {
+    if(e->history[i].cycles + cycles <= MAX_SAMPLE_CYCLES) {
+      e->history[j].cycles = e->history[i].cycles + cycles;
+      e->history[j].offset = e->history[i].offset - offset;
+      j++;
+    }
+  }
+  if(j == PHASE_HISTORY) {
+    j--;
+  }
+  memmove(&e->history[1], &e->history[0], j * sizeof(e->history[0]));
+  e->history[0].cycles = cycles;
+  e->history[0].offset = -offset;
+  e->samples = j + 1;
+
+  estimate_skew(e);
+  PRINTF("phase %d.%d skew %d error %u\n", e->neighbor.u8[0],
+         e->neighbor.u8[1], e->skew, e->error);
+}
+#endif /* PHASE_DRIFT_CORRECT */
+/*---------------------------------------------------------------------------*/
 void
 phase_update(const struct phase_list *list,
              const rimeaddr_t *neighbor, rtimer_clock_t time,
-             int mac_status)
+             rtimer_clock_t cycle_time, int mac_status)
 {
   struct phase *e;
 
@@ -108,23 +335,30 @@ phase_update(const struct phase_list *list,
   if(e != NULL) {
     if(mac_status == MAC_TX_OK) {
 #if PHASE_DRIFT_CORRECT
-      e->drift = time-e->time;
+      add_sample(e, time, cycle_time);
+      e->clock = clock_time();
 #endif
       e->time = time;
+      phase_refresh(list, neighbor);
     }
     /* If the neighbor didn't reply to us, it may have switched
        phase (rebooted). We try a number of transmissions to it
        before we drop it from the phase list. */
     if(mac_status == MAC_TX_NOACK) {
       PRINTF("phase noacks %d to %d.%d\n", e->noacks, neighbor->u8[0], neighbor->u8[1]);
+      if(e->cycle_shift > 0) {
+        /* The neighbor may have stopped doing the extra channel check
+           that we have timed our transmissions with. */
+        remove_neighbor(list, e);
+        return;
+      }
       e->noacks++;
       if(e->noacks == 1) {
         timer_set(&e->noacks_timer, MAX_NOACKS_TIME);
       }
       if(e->noacks >= MAX_NOACKS || timer_expired(&e->noacks_timer)) {
         PRINTF("drop %d\n", neighbor->u8[0]);
-        list_remove(*list->list, e);
-        memb_free(list->memb, e);
+        remove_neighbor(list, e);
         return;
       }
     } else if(mac_status == MAC_TX_OK) {
@@ -132,21 +366,18 @@ phase_update(const struct phase_list *list,
     }
   } else {
     /* No matching phase was found, so we allocate a new one. */
-    if(mac_status == MAC_TX_OK && e == NULL) {
-      e = memb_alloc(list->memb);
+    if(mac_status == MAC_TX_OK) {
+      e = add_neighbor(list, neighbor);
       if(e == NULL) {
-        PRINTF("phase alloc NULL\n");
-        /* We could not allocate memory for this phase, so we drop
-           the last item on the list and reuse it for our phase. */
-        e = list_chop(*list->list);
+        return;
       }
-      rimeaddr_copy(&e->neighbor, neighbor);
       e->time = time;
 #if PHASE_DRIFT_CORRECT
-      e->drift = 0;
+      e->clock = clock_time();
+      reset_samples(e);
 #endif
+      e->cycle_shift = 0;
       e->noacks = 0;
-      list_push(*list->list, e);
     }
   }
 }
@@ -204,16 +435,29 @@ phase_wait(struct phase_list *list,
     sync = (e == NULL) ? now : e->time;
 
 #if PHASE_DRIFT_CORRECT
-    {
-      int32_t s;
-      if(e->drift > cycle_time) {
-        s = e->drift % cycle_time / (e->drift / cycle_time);  /* drift per cycle */
-        s = s * (now - sync) / cycle_time;                    /* estimated drift to now */
-        sync += s;                                            /* add it in */
+    if(e->samples > 0) {
+      int32_t t;
+
+      t = elapsed(e, now);
+      if(t >= 0) {
+        /* Move the phase by the skew accumulated up to the next
+           wake-up. The skew may be negative, so the correction is
+           computed in signed arithmetic whatever the width of
+           rtimer_clock_t. */
+        sync += (int32_t)(t / (int32_t)cycle_time + 1) * e->skew / 256;
+        /* The better the latest wake-up was predicted, the shorter
+           the time that we start transmitting before the next one.
+           After a missed wake-up, we use the full guard time. */
+        if(e->noacks == 0 && e->error != NO_ESTIMATE &&
+           guard_time / 4 + 2 * e->error < guard_time) {
+          guard_time = guard_time / 4 + 2 * e->error;
+        }
       }
     }
 #endif
 
+    cycle_time >>= e->cycle_shift;
+
     /* Check if cycle_time is a power of two */
     if(!(cycle_time & (cycle_time - 1))) {
       /* Faster if cycle_time is a power of two */
@@ -263,6 +507,7 @@ phase_init(struct phase_list *list)
 {
   list_init(*list->list);
   memb_init(list->memb);
+  memset(list->hash, 0, sizeof(struct phase *) * PHASE_HASH_SIZE);
   memb_init(&queued_packets_memb);
 }
 /*---------------------------------------------------------------------------*/
@@ -47,19 +47,57 @@
 #include "lib/memb.h"
 #include "net/netstack.h"
 
-#if PHASE_CONF_DRIFT_CORRECT
+/* When set, the clock skew of every neighbor is estimated from its
+   last observed wake-ups, and used to predict its next wake-up and to
+   shorten the time we start transmitting before it. */
+#ifdef PHASE_CONF_DRIFT_CORRECT
 #define PHASE_DRIFT_CORRECT PHASE_CONF_DRIFT_CORRECT
 #else
-#define PHASE_DRIFT_CORRECT 0
+#define PHASE_DRIFT_CORRECT 1
 #endif
 
+/* The number of earlier wake-ups kept per neighbor for the skew
+   estimate. */
+#ifdef PHASE_CONF_HISTORY
+#define PHASE_HISTORY PHASE_CONF_HISTORY
+#else
+#define PHASE_HISTORY 3
+#endif
+
+/* The number of hash buckets for neighbor lookups, a power of two. */
+#ifdef PHASE_CONF_HASH_SIZE
+#define PHASE_HASH_SIZE PHASE_CONF_HASH_SIZE
+#else
+#define PHASE_HASH_SIZE 8
+#endif
+
+#if PHASE_DRIFT_CORRECT
+struct phase_sample {
+  /* The number of cycles between this wake-up and the latest one. */
+  uint16_t cycles;
+  /* How much later this wake-up was than the latest one minus the
+     nominal cycle time. */
+  int16_t offset;
+};
+#endif /* PHASE_DRIFT_CORRECT */
+
 struct phase {
   struct phase *next;
+  struct phase *hash_next;
   rimeaddr_t neighbor;
   rtimer_clock_t time;
 #if PHASE_DRIFT_CORRECT
-  rtimer_clock_t drift;
+  clock_time_t clock;
+  /* The estimated clock skew, in 1/256 rtimer ticks per cycle. */
+  int16_t skew;
+  /* The difference between the predicted and the observed time of
+     the latest wake-up. */
+  uint16_t error;
+  uint8_t samples;
+  struct phase_sample history[PHASE_HISTORY];
 #endif
+  /* The neighbor checks the channel 2^cycle_shift times per cycle. */
+  uint8_t cycle_shift;
   uint8_t noacks;
   struct timer noacks_timer;
 };
@@ -67,6 +105,7 @@ struct phase {
 struct phase_list {
   list_t *list;
   struct memb *memb;
+  struct phase **hash;
 };
 
 typedef enum {
@@ -78,7 +117,9 @@ typedef enum {
 
 #define PHASE_LIST(name, num) LIST(phase_list_list);                              \
                               MEMB(phase_list_memb, struct phase, num);           \
-                              struct phase_list name = { &phase_list_list, &phase_list_memb }
+                              static struct phase *phase_list_hash[PHASE_HASH_SIZE]; \
+                              struct phase_list name = { &phase_list_list, &phase_list_memb, \
+                                                         phase_list_hash }
 
 void phase_init(struct phase_list *list);
 phase_status_t phase_wait(struct phase_list *list,  const rimeaddr_t *neighbor,
@@ -86,7 +127,11 @@ phase_status_t phase_wait(struct phase_list *list,  const rimeaddr_t *neighbor,
                           mac_callback_t mac_callback, void *mac_callback_ptr,
                           struct rdc_buf_list *buf_list);
 void phase_update(const struct phase_list *list, const rimeaddr_t *neighbor,
-                  rtimer_clock_t time, int mac_status);
+                  rtimer_clock_t time, rtimer_clock_t cycle_time,
+                  int mac_status);
+void phase_refresh(const struct phase_list *list, const rimeaddr_t *neighbor);
+void phase_set_cycle_shift(const struct phase_list *list,
+                           const rimeaddr_t *neighbor, uint8_t cycle_shift);
 
 void phase_remove(const struct phase_list *list, const rimeaddr_t *neighbor);
 
@@ -37,85 +37,23 @@
  */
 
 #include "net/neighbor-info.h"
-#include "net/neighbor-attr.h"
+#include "net/link-stats.h"
 #include "net/uip-ds6.h"
 #include "net/uip-nd6.h"
 
 #define DEBUG DEBUG_NONE
 #include "net/uip-debug.h"
 
-#define ETX_LIMIT		15
-#define ETX_SCALE		100
-#define ETX_ALPHA		90
-#define ETX_NOACK_PENALTY       ETX_LIMIT
+#define ETX_LIMIT		LINK_STATS_ETX_LIMIT
 /*---------------------------------------------------------------------------*/
-NEIGHBOR_ATTRIBUTE_GLOBAL(link_metric_t, attr_etx, NULL);
-NEIGHBOR_ATTRIBUTE_GLOBAL(unsigned long, attr_timestamp, NULL);
-
 static neighbor_info_subscriber_t subscriber_callback;
 /*---------------------------------------------------------------------------*/
-static void
-update_metric(const rimeaddr_t *dest, int packet_metric)
-{
-  static link_metric_t *metricp;
-  static link_metric_t recorded_metric;
-  static link_metric_t new_metric;
-  unsigned long time;
-  int first_update = 0;
-
-  metricp = (link_metric_t *)neighbor_attr_get_data(&attr_etx, dest);
-  packet_metric = NEIGHBOR_INFO_ETX2FIX(packet_metric);
-  if(metricp == NULL || *metricp == 0) {
-    recorded_metric = NEIGHBOR_INFO_ETX2FIX(ETX_LIMIT);
-    new_metric = packet_metric;
-    first_update = 1;
-  } else {
-    recorded_metric = *metricp;
-    /* Update the EWMA of the ETX for the neighbor. */
-    new_metric = ((uint16_t)recorded_metric * ETX_ALPHA +
-               (uint16_t)packet_metric * (ETX_SCALE - ETX_ALPHA)) / ETX_SCALE;
-  }
-
-  PRINTF("neighbor-info: ETX changed from %d to %d (packet ETX = %d) %d\n",
-	 NEIGHBOR_INFO_FIX2ETX(recorded_metric),
-	 NEIGHBOR_INFO_FIX2ETX(new_metric),
-	 NEIGHBOR_INFO_FIX2ETX(packet_metric),
-         dest->u8[7]);
-
-  if(neighbor_attr_has_neighbor(dest)) {
-    time = clock_seconds();
-    neighbor_attr_set_data(&attr_etx, dest, &new_metric);
-    neighbor_attr_set_data(&attr_timestamp, dest, &time);
-    if((first_update || new_metric != recorded_metric) && subscriber_callback != NULL) {
-      subscriber_callback(dest, 1, new_metric);
-    }
-  }
-}
-/*---------------------------------------------------------------------------*/
-#if NETSTACK_CONF_SHORTCUTS
-#define add_neighbor(a) neighbor_attr_add_neighbor(a)
-#else
-static void
-add_neighbor(const rimeaddr_t *addr)
-{
-  switch(neighbor_attr_add_neighbor(addr)) {
-  case -1:
-    PRINTF("neighbor-info: failed to add a node.\n");
-    break;
-  case 0:
-    PRINTF("neighbor-info: The neighbor is already known\n");
-    break;
-  default:
-    break;
-  }
-}
-#endif
-/*---------------------------------------------------------------------------*/
 void
 neighbor_info_packet_sent(int status, int numtx)
 {
   static const rimeaddr_t *dest;
-  static link_metric_t packet_metric;
+  const struct link_stats *stats;
+  uint16_t recorded_metric;
 #if UIP_DS6_LL_NUD
   uip_ds6_nbr_t *nbr;
 #endif /* UIP_DS6_LL_NUD */
@@ -125,15 +63,16 @@ neighbor_info_packet_sent(int status, int numtx)
     return;
   }
 
-  packet_metric = numtx;
-
-  PRINTF("neighbor-info: packet sent to %d.%d, status=%d, metric=%u\n",
+  PRINTF("neighbor-info: packet sent to %d.%d, status=%d, numtx=%d\n",
 	dest->u8[sizeof(*dest) - 2], dest->u8[sizeof(*dest) - 1],
-	status, (unsigned)packet_metric);
+	status, numtx);
+
+  stats = link_stats_from_lladdr(dest);
+  recorded_metric = stats != NULL ? stats->etx : 0;
+  link_stats_packet_sent(dest, status, numtx);
 
   switch(status) {
   case MAC_TX_OK:
-    add_neighbor(dest);
 #if UIP_DS6_LL_NUD
     nbr = uip_ds6_nbr_ll_lookup((uip_lladdr_t *)dest);
     if(nbr != NULL &&
@@ -147,15 +86,26 @@ neighbor_info_packet_sent(int status, int numtx)
 #endif /* UIP_DS6_LL_NUD */
     break;
   case MAC_TX_NOACK:
-    packet_metric = ETX_NOACK_PENALTY;
     break;
   default:
-    /* Do not penalize the ETX when collisions or transmission
-       errors occur. */
+    /* The link statistics are not changed by collisions or
+       transmission errors. */
     return;
   }
 
-  update_metric(dest, packet_metric);
+  stats = link_stats_from_lladdr(dest);
+  if(stats == NULL) {
+    return;
+  }
+
+  PRINTF("neighbor-info: ETX changed from %d to %d\n",
+	 NEIGHBOR_INFO_FIX2ETX(recorded_metric),
+	 NEIGHBOR_INFO_FIX2ETX(stats->etx));
+
+  if((recorded_metric == 0 || stats->etx != recorded_metric) &&
+     subscriber_callback != NULL) {
+    subscriber_callback(dest, 1, (link_metric_t)stats->etx);
+  }
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -171,15 +121,13 @@ neighbor_info_packet_received(void)
   PRINTF("neighbor-info: packet received from %d.%d\n",
 	src->u8[sizeof(*src) - 2], src->u8[sizeof(*src) - 1]);
 
-  add_neighbor(src);
+  link_stats_input_callback(src);
 }
 /*---------------------------------------------------------------------------*/
 int
 neighbor_info_subscribe(neighbor_info_subscriber_t s)
 {
   if(subscriber_callback == NULL) {
-    neighbor_attr_register(&attr_etx);
-    neighbor_attr_register(&attr_timestamp);
     subscriber_callback = s;
     return 1;
   }
@@ -190,9 +138,9 @@ neighbor_info_subscribe(neighbor_info_subscriber_t s)
 link_metric_t
 neighbor_info_get_metric(const rimeaddr_t *addr)
 {
-  link_metric_t *metricp;
+  const struct link_stats *stats;
 
-  metricp = (link_metric_t *)neighbor_attr_get_data(&attr_etx, addr);
-  return metricp == NULL ? ETX_LIMIT : *metricp;
+  stats = link_stats_from_lladdr(addr);
+  return stats == NULL || stats->etx == 0 ? ETX_LIMIT : stats->etx;
 }
 /*---------------------------------------------------------------------------*/
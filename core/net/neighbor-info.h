@@ -39,12 +39,12 @@
 #ifndef NEIGHBOR_INFO_H
 #define NEIGHBOR_INFO_H
 
-#include "net/neighbor-attr.h"
+#include "net/link-stats.h"
 #include "net/rime.h"
 
 /* ETX_DIVISOR is the value that a fix-point representation of the ETX 
    should be divided by in order to obtain the integer representation. */
-#define NEIGHBOR_INFO_ETX_DIVISOR       16
+#define NEIGHBOR_INFO_ETX_DIVISOR       LINK_STATS_ETX_DIVISOR
 
 /* Macros for converting between a fix-point representation of the ETX 
    and a integer representation. */
@@ -54,12 +54,10 @@
 typedef void (*neighbor_info_subscriber_t)(const rimeaddr_t *, int known, int etx);
 typedef uint8_t link_metric_t;
 
-NEIGHBOR_ATTRIBUTE_DECLARE(attr_etx);
-NEIGHBOR_ATTRIBUTE_DECLARE(attr_timestamp);
-
 /**
  * Notify the neighbor information module about the status of
- * a packet transmission.
+ * a packet transmission. The ETX of the neighbor is updated in the
+ * link statistics table, and the subscriber is told if it changed.
  *
  * \param status The MAC status code for this packet.
  *
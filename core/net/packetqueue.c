@@ -122,6 +122,14 @@ packetqueue_dequeue(struct packetqueue *q)
   }
 }
 /*---------------------------------------------------------------------------*/
+void
+packetqueue_remove(struct packetqueue *q, struct packetqueue_item *i)
+{
+  if(i != NULL && i->queue == q) {
+    remove_queued_packet(i);
+  }
+}
+/*---------------------------------------------------------------------------*/
 int
 packetqueue_len(struct packetqueue *q)
 {
@@ -148,4 +156,31 @@ packetqueue_ptr(struct packetqueue_item *i)
   }
 }
 /*---------------------------------------------------------------------------*/
+struct packetqueue_item *
+packetqueue_next(struct packetqueue_item *i)
+{
+  if(i != NULL) {
+    return list_item_next(i);
+  } else {
+    return NULL;
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+packetqueue_update_packetbuf(struct packetqueue_item *i)
+{
+  struct queuebuf *buf;
+
+  if(i == NULL) {
+    return 0;
+  }
+  buf = queuebuf_new_from_packetbuf();
+  if(buf == NULL) {
+    return 0;
+  }
+  queuebuf_free(i->buf);
+  i->buf = buf;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
 /** @} */
@@ -189,6 +189,18 @@ void packetqueue_dequeue(struct packetqueue *q);
  */
 int packetqueue_len(struct packetqueue *q);
 
+/**
+ * \brief      Remove an item from the packet queue
+ * \param q    A pointer to a struct packetqueue.
+ * \param i    A packet queue item on the queue q.
+ *
+ *             This function removes an arbitrary item from the
+ *             packet queue and frees its queuebuf. It is used by
+ *             modules that merge several queued packets into one.
+ *
+ */
+void packetqueue_remove(struct packetqueue *q, struct packetqueue_item *i);
+
 /**
  * @}
  */
@@ -211,6 +223,26 @@ struct queuebuf *packetqueue_queuebuf(struct packetqueue_item *i);
  */
 
 void *packetqueue_ptr(struct packetqueue_item *i);
+
+/**
+ * \brief      Access the next item on the packet queue.
+ * \param i    A packet queue item, obtained with packetqueue_first().
+ * \return     The item following i, or NULL if i is the last item.
+ */
+struct packetqueue_item *packetqueue_next(struct packetqueue_item *i);
+
+/**
+ * \brief      Replace the queuebuf of a packet queue item with the packetbuf.
+ * \param i    A packet queue item, obtained with packetqueue_first().
+ * \retval Zero   If memory could not be allocated for the new queuebuf.
+ * \retval Non-zero If the queuebuf was replaced.
+ *
+ *             This function copies the contents of the \ref
+ *             packetbuf "packetbuf" into a new queuebuf that replaces
+ *             the one held by the packet queue item. The position of
+ *             the item in the queue and its lifetime are unchanged.
+ */
+int packetqueue_update_packetbuf(struct packetqueue_item *i);
 /**
  * @}
  */
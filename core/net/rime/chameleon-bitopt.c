@@ -57,6 +57,15 @@ struct bitopt_hdr {
   uint8_t channel[2];
 };
 
+/*
+ * The header is the attributes of the channel packed back to back,
+ * most significant bit first, in the order of the attribute list.
+ * Attributes are copied a byte at a time: a byte at an unaligned bit
+ * position is a 16-bit shift or:ed into the two header bytes it
+ * straddles, so the cost is per byte, not per bit. The size of the
+ * header is computed once, when the attributes of the channel are
+ * set (c->hdrsize).
+ */
 static const uint8_t bitmask[9] = { 0x00, 0x80, 0xc0, 0xe0, 0xf0,
 				 0xf8, 0xfc, 0xfe, 0xff };
 
@@ -51,6 +51,7 @@
 
 #include "net/rime/collect-neighbor.h"
 #include "net/rime/collect.h"
+#include "net/link-stats.h"
 
 #ifdef COLLECT_NEIGHBOR_CONF_MAX_COLLECT_NEIGHBORS
 #define MAX_COLLECT_NEIGHBORS COLLECT_NEIGHBOR_CONF_MAX_COLLECT_NEIGHBORS
@@ -77,6 +78,25 @@ MEMB(collect_neighbors_mem, struct collect_neighbor, MAX_COLLECT_NEIGHBORS);
 #define PRINTF(...)
 #endif
 
+/*---------------------------------------------------------------------------*/
+/* Start a new link estimate for a neighbor. If the link statistics
+   of the neighbor are fresh, their ETX is used as the first estimate
+   so that the neighbor does not have to start from the pessimistic
+   initial estimate. */
+static void
+new_link_estimate(struct collect_neighbor *n)
+{
+  const struct link_stats *stats;
+
+  collect_link_estimate_new(&n->le);
+  n->le_age = 0;
+  stats = link_stats_from_lladdr(&n->addr);
+  if(link_stats_is_fresh(stats)) {
+    collect_link_estimate_update_tx(&n->le,
+                                    (stats->etx + LINK_STATS_ETX_DIVISOR / 2) /
+                                    LINK_STATS_ETX_DIVISOR);
+  }
+}
 /*---------------------------------------------------------------------------*/
 static void
 periodic(void *ptr)
@@ -93,8 +113,7 @@ periodic(void *ptr)
   }
   for(n = list_head(neighbor_list->list); n != NULL; n = list_item_next(n)) {
     if(n->le_age == MAX_LE_AGE) {
-      collect_link_estimate_new(&n->le);
-      n->le_age = 0;
+      new_link_estimate(n);
     }
     if(n->age == MAX_AGE) {
       memb_free(&collect_neighbors_mem, n);
@@ -216,8 +235,7 @@ collect_neighbor_list_add(struct collect_neighbor_list *neighbors_list,
     n->age = 0;
     rimeaddr_copy(&n->addr, addr);
     n->rtmetric = nrtmetric;
-    collect_link_estimate_new(&n->le);
-    n->le_age = 0;
+    new_link_estimate(n);
     return 1;
   }
   return 0;
@@ -91,6 +91,31 @@ struct data_msg_hdr {
   uint16_t rtmetric;
 };
 
+#if COLLECT_AGGREGATION
+/* If the DATA_FLAGS_AGGREGATE flag is set in the header of a data
+   packet, the packet carries several packets that were queued for the
+   same parent. Each of them is preceded by an aggregate_hdr that holds
+   the originator, sequence number, and hop count of the packet at the
+   time it was aggregated, and the length of the data that follows. */
+#define DATA_FLAGS_AGGREGATE            0x01
+
+struct aggregate_hdr {
+  rimeaddr_t originator;
+  uint8_t eseqno;
+  uint8_t hops;
+  uint8_t len;
+};
+
+/* AGGREGATION_MAXLEN is the maximum size of the data part of an
+   aggregated packet, including the data packet header. The default
+   leaves PACKETBUF_HDR_SIZE bytes for the Rime and MAC headers. */
+#ifdef COLLECT_CONF_AGGREGATION_MAXLEN
+#define AGGREGATION_MAXLEN COLLECT_CONF_AGGREGATION_MAXLEN
+#else /* COLLECT_CONF_AGGREGATION_MAXLEN */
+#define AGGREGATION_MAXLEN (PACKETBUF_SIZE - PACKETBUF_HDR_SIZE)
+#endif /* COLLECT_CONF_AGGREGATION_MAXLEN */
+#endif /* COLLECT_AGGREGATION */
+
 
 /* This is the header of ACK packets. It contains a flags field that
    indicates if the node is congested (ACK_FLAGS_CONGESTED), if the
@@ -189,6 +214,13 @@ struct {
   uint32_t ttldrop;
   uint32_t ackdrop;
   uint32_t timedout;
+
+#if COLLECT_AGGREGATION
+  uint32_t aggsent;
+  uint32_t aggpackets;
+  uint32_t aggrecv;
+  uint32_t aggdelivered;
+#endif /* COLLECT_AGGREGATION */
 } stats;
 
 /* Debug definition: draw routing tree in Cooja. */
@@ -462,6 +494,7 @@ enqueue_dummy_packet(struct collect_conn *c, int rexmits)
 
   /* Allocate space for the header. */
   packetbuf_hdralloc(sizeof(struct data_msg_hdr));
+  memset(packetbuf_hdrptr(), 0, sizeof(struct data_msg_hdr));
 
   n = collect_neighbor_list_find(&c->neighbor_list, &c->parent);
   if(n != NULL) {
@@ -541,6 +574,156 @@ proactive_probing_callback(void *ptr)
   }
 }
 /*---------------------------------------------------------------------------*/
+#if COLLECT_AGGREGATION
+/**
+ * This function returns a pointer to the data of the next packet in
+ * an aggregated packet and copies its header into ahdr. The ptr and
+ * remaining arguments are updated to point past the packet. NULL is
+ * returned when there are no more packets or if the aggregated packet
+ * is malformed.
+ *
+ */
+static uint8_t *
+aggregate_next(uint8_t **ptr, uint16_t *remaining, struct aggregate_hdr *ahdr)
+{
+  uint8_t *data;
+
+  if(*remaining < sizeof(struct aggregate_hdr)) {
+    return NULL;
+  }
+  memcpy(ahdr, *ptr, sizeof(struct aggregate_hdr));
+  if(ahdr->len > *remaining - sizeof(struct aggregate_hdr)) {
+    return NULL;
+  }
+  data = *ptr + sizeof(struct aggregate_hdr);
+  *ptr = data + ahdr->len;
+  *remaining -= sizeof(struct aggregate_hdr) + ahdr->len;
+  return data;
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * This function coalesces the packets at the head of the send queue
+ * into a single aggregated packet that replaces the first packet on
+ * the queue. Packets are added in queue order until the next one
+ * would not fit within AGGREGATION_MAXLEN bytes. Packets that already
+ * are aggregated are flattened into the new packet. Keepalives and
+ * proactive probes, which carry no data, are never aggregated.
+ *
+ */
+static void
+aggregate_queued_packets(struct collect_conn *c)
+{
+  struct packetqueue_item *first, *i, *next;
+  struct queuebuf *q;
+  struct data_msg_hdr hdr;
+  struct aggregate_hdr ahdr;
+  uint8_t *buf, *ptr;
+  uint16_t len, datalen, remaining;
+  uint8_t hops, ttl, max_rexmits, num, npackets;
+
+  first = packetqueue_first(&c->send_queue);
+  if(first == NULL || packetqueue_next(first) == NULL) {
+    return;
+  }
+
+  packetbuf_clear();
+  buf = packetbuf_dataptr();
+  len = sizeof(struct data_msg_hdr);
+  ttl = MAX_HOPLIM;
+  max_rexmits = 0;
+  num = npackets = 0;
+
+  for(i = first; i != NULL; i = packetqueue_next(i)) {
+    q = packetqueue_queuebuf(i);
+    if(queuebuf_datalen(q) <= sizeof(struct data_msg_hdr)) {
+      break;
+    }
+    datalen = queuebuf_datalen(q) - sizeof(struct data_msg_hdr);
+    hops = queuebuf_attr(q, PACKETBUF_ATTR_HOPS);
+    memcpy(&hdr, queuebuf_dataptr(q), sizeof(struct data_msg_hdr));
+
+    if(hdr.flags & DATA_FLAGS_AGGREGATE) {
+      if(len + datalen > AGGREGATION_MAXLEN) {
+        break;
+      }
+      memcpy(buf + len,
+             (uint8_t *)queuebuf_dataptr(q) + sizeof(struct data_msg_hdr),
+             datalen);
+
+      /* The hop counts of the inner packets are relative to the
+         aggregated packet, so we add the hops it has travelled. */
+      ptr = buf + len;
+      remaining = datalen;
+      while(aggregate_next(&ptr, &remaining, &ahdr) != NULL) {
+        ahdr.hops += hops - 1;
+        memcpy(ptr - ahdr.len - sizeof(struct aggregate_hdr), &ahdr,
+               sizeof(struct aggregate_hdr));
+        npackets++;
+      }
+      len += datalen;
+    } else {
+      if(datalen > 0xff ||
+         len + sizeof(struct aggregate_hdr) + datalen > AGGREGATION_MAXLEN) {
+        break;
+      }
+      rimeaddr_copy(&ahdr.originator,
+                    queuebuf_addr(q, PACKETBUF_ADDR_ESENDER));
+      ahdr.eseqno = queuebuf_attr(q, PACKETBUF_ATTR_EPACKET_ID);
+      ahdr.hops = hops;
+      ahdr.len = datalen;
+      memcpy(buf + len, &ahdr, sizeof(struct aggregate_hdr));
+      len += sizeof(struct aggregate_hdr);
+      memcpy(buf + len,
+             (uint8_t *)queuebuf_dataptr(q) + sizeof(struct data_msg_hdr),
+             datalen);
+      len += datalen;
+      npackets++;
+    }
+
+    if(queuebuf_attr(q, PACKETBUF_ATTR_TTL) < ttl) {
+      ttl = queuebuf_attr(q, PACKETBUF_ATTR_TTL);
+    }
+    if(queuebuf_attr(q, PACKETBUF_ATTR_MAX_REXMIT) > max_rexmits) {
+      max_rexmits = queuebuf_attr(q, PACKETBUF_ATTR_MAX_REXMIT);
+    }
+    num++;
+  }
+
+  /* There is no point in aggregating a single packet. */
+  if(num < 2) {
+    return;
+  }
+
+  memset(&hdr, 0, sizeof(hdr));
+  hdr.flags = DATA_FLAGS_AGGREGATE;
+  memcpy(buf, &hdr, sizeof(struct data_msg_hdr));
+  packetbuf_set_datalen(len);
+
+  packetbuf_set_addr(PACKETBUF_ADDR_ESENDER, &rimeaddr_node_addr);
+  packetbuf_set_attr(PACKETBUF_ATTR_HOPS, 1);
+  packetbuf_set_attr(PACKETBUF_ATTR_TTL, ttl);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAX_REXMIT, max_rexmits);
+
+  PRINTF("%d.%d: aggregated %d queued packets (%d packets), %d bytes\n",
+         rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1],
+         num, npackets, len);
+
+  /* Remove the packets that were merged into the first one. Their
+     queuebufs are freed before the first packet is updated, so there
+     is always a queuebuf available for the aggregated packet. */
+  i = packetqueue_next(first);
+  while(--num > 0) {
+    next = packetqueue_next(i);
+    packetqueue_remove(&c->send_queue, i);
+    i = next;
+  }
+  packetqueue_update_packetbuf(first);
+
+  stats.aggsent++;
+  stats.aggpackets += npackets;
+}
+#endif /* COLLECT_AGGREGATION */
+/*---------------------------------------------------------------------------*/
 /**
  * This function is called when a queued packet should be sent
  * out. The function takes the first packet on the output queue, adds
@@ -566,6 +749,11 @@ send_queued_packet(struct collect_conn *c)
   }
 
 
+#if COLLECT_AGGREGATION
+  /* Coalesce the packets on the send queue into the first one. */
+  aggregate_queued_packets(c);
+#endif /* COLLECT_AGGREGATION */
+
   /* Grab the first packet on the send queue. */
   i = packetqueue_first(&c->send_queue);
   if(i == NULL) {
@@ -625,8 +813,8 @@ send_queued_packet(struct collect_conn *c)
       stats.datasent++;
 
       /* Copy our rtmetric into the packet header of the outgoing
-         packet. */
-      memset(&hdr, 0, sizeof(hdr));
+         packet. The flags of the header are kept. */
+      memcpy(&hdr, packetbuf_dataptr(), sizeof(struct data_msg_hdr));
       hdr.rtmetric = c->rtmetric;
       memcpy(packetbuf_dataptr(), &hdr, sizeof(struct data_msg_hdr));
 
@@ -724,8 +912,8 @@ retransmit_current_packet(struct collect_conn *c)
       packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, c->seqno);
 
       /* Copy our rtmetric into the packet header of the outgoing
-         packet. */
-      memset(&hdr, 0, sizeof(hdr));
+         packet. The flags of the header are kept. */
+      memcpy(&hdr, packetbuf_dataptr(), sizeof(struct data_msg_hdr));
       hdr.rtmetric = c->rtmetric;
       memcpy(packetbuf_dataptr(), &hdr, sizeof(struct data_msg_hdr));
 
@@ -885,6 +1073,32 @@ send_ack(struct collect_conn *tc, const rimeaddr_t *to, int flags)
 }
 /*---------------------------------------------------------------------------*/
 static void
+add_to_recent_packets(struct collect_conn *tc, const rimeaddr_t *originator,
+                      uint8_t eseqno)
+{
+  recent_packets[recent_packet_ptr].eseqno = eseqno;
+  rimeaddr_copy(&recent_packets[recent_packet_ptr].originator, originator);
+  recent_packets[recent_packet_ptr].conn = tc;
+  recent_packet_ptr = (recent_packet_ptr + 1) % NUM_RECENT_PACKETS;
+}
+/*---------------------------------------------------------------------------*/
+static int
+is_recent_packet(struct collect_conn *tc, const rimeaddr_t *originator,
+                 uint8_t eseqno)
+{
+  int i;
+
+  for(i = 0; i < NUM_RECENT_PACKETS; i++) {
+    if(recent_packets[i].conn == tc &&
+       recent_packets[i].eseqno == eseqno &&
+       rimeaddr_cmp(&recent_packets[i].originator, originator)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
 add_packet_to_recent_packets(struct collect_conn *tc)
 {
   /* Remember that we have seen this packet for later, but only if
@@ -892,21 +1106,136 @@ add_packet_to_recent_packets(struct collect_conn *tc)
      zero are keepalive or proactive link estimate probes, so we do
      not record them in our history. */
   if(packetbuf_datalen() > sizeof(struct data_msg_hdr)) {
-    recent_packets[recent_packet_ptr].eseqno =
-      packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID);
-    rimeaddr_copy(&recent_packets[recent_packet_ptr].originator,
-                  packetbuf_addr(PACKETBUF_ADDR_ESENDER));
-    recent_packets[recent_packet_ptr].conn = tc;
-    recent_packet_ptr = (recent_packet_ptr + 1) % NUM_RECENT_PACKETS;
+#if COLLECT_AGGREGATION
+    struct data_msg_hdr hdr;
+
+    memcpy(&hdr, packetbuf_dataptr(), sizeof(struct data_msg_hdr));
+    if(hdr.flags & DATA_FLAGS_AGGREGATE) {
+      struct aggregate_hdr ahdr;
+      uint8_t *ptr;
+      uint16_t remaining;
+
+      /* For aggregated packets, we remember each of the packets. */
+      ptr = (uint8_t *)packetbuf_dataptr() + sizeof(struct data_msg_hdr);
+      remaining = packetbuf_datalen() - sizeof(struct data_msg_hdr);
+      while(aggregate_next(&ptr, &remaining, &ahdr) != NULL) {
+        add_to_recent_packets(tc, &ahdr.originator, ahdr.eseqno);
+      }
+      return;
+    }
+#endif /* COLLECT_AGGREGATION */
+    add_to_recent_packets(tc, packetbuf_addr(PACKETBUF_ADDR_ESENDER),
+                          packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
+  }
+}
+/*---------------------------------------------------------------------------*/
+/**
+ * This function checks if the packet in the packetbuf is a duplicate
+ * of a packet we recently received. An aggregated packet is a
+ * duplicate only if all the packets in it are.
+ *
+ */
+static int
+is_duplicate_packet(struct collect_conn *tc)
+{
+#if COLLECT_AGGREGATION
+  struct data_msg_hdr hdr;
+
+  memcpy(&hdr, packetbuf_dataptr(), sizeof(struct data_msg_hdr));
+  if(hdr.flags & DATA_FLAGS_AGGREGATE) {
+    struct aggregate_hdr ahdr;
+    uint8_t *ptr;
+    uint16_t remaining;
+
+    ptr = (uint8_t *)packetbuf_dataptr() + sizeof(struct data_msg_hdr);
+    remaining = packetbuf_datalen() - sizeof(struct data_msg_hdr);
+    while(aggregate_next(&ptr, &remaining, &ahdr) != NULL) {
+      if(!is_recent_packet(tc, &ahdr.originator, ahdr.eseqno)) {
+        return 0;
+      }
+    }
+    return 1;
+  }
+#endif /* COLLECT_AGGREGATION */
+  return is_recent_packet(tc, packetbuf_addr(PACKETBUF_ADDR_ESENDER),
+                          packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID));
+}
+/*---------------------------------------------------------------------------*/
+#if COLLECT_AGGREGATION
+/**
+ * This function is called at the sink to unpack an aggregated packet
+ * and call the receive function for each of the packets in it. The
+ * packetbuf data and attributes are set up for each packet as if it
+ * had been received on its own.
+ *
+ * The receive function may send packets or otherwise reuse the
+ * packetbuf, so the aggregated packet is kept in a queuebuf and the
+ * packetbuf is restored from it before each packet is unpacked.
+ *
+ */
+static void
+deliver_aggregate(struct collect_conn *tc)
+{
+  struct aggregate_hdr ahdr;
+  struct queuebuf *q;
+  uint8_t *ptr, *data;
+  uint16_t offset, remaining;
+  uint8_t hops;
+
+  stats.aggrecv++;
+  hops = packetbuf_attr(PACKETBUF_ATTR_HOPS);
+
+  packetbuf_hdrreduce(sizeof(struct data_msg_hdr));
+  q = queuebuf_new_from_packetbuf();
+  if(q == NULL) {
+    PRINTF("%d.%d: collect: could not deliver aggregated packet: no queued buffers\n",
+           rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1]);
+    stats.qdrop++;
+    return;
+  }
+
+  offset = 0;
+  for(;;) {
+    queuebuf_to_packetbuf(q);
+    ptr = (uint8_t *)packetbuf_dataptr() + offset;
+    remaining = packetbuf_datalen() - offset;
+    data = aggregate_next(&ptr, &remaining, &ahdr);
+    if(data == NULL) {
+      break;
+    }
+    offset = ptr - (uint8_t *)packetbuf_dataptr();
+
+    if(is_recent_packet(tc, &ahdr.originator, ahdr.eseqno)) {
+      stats.duprecv++;
+      continue;
+    }
+    add_to_recent_packets(tc, &ahdr.originator, ahdr.eseqno);
+    stats.aggdelivered++;
+
+    packetbuf_hdrreduce(data - (uint8_t *)packetbuf_dataptr());
+    packetbuf_set_datalen(ahdr.len);
+    packetbuf_set_addr(PACKETBUF_ADDR_ESENDER, &ahdr.originator);
+    packetbuf_set_attr(PACKETBUF_ATTR_EPACKET_ID, ahdr.eseqno);
+    packetbuf_set_attr(PACKETBUF_ATTR_HOPS, ahdr.hops + hops - 1);
+
+    PRINTF("%d.%d: sink received aggregated packet %d from %d.%d\n",
+           rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1],
+           ahdr.eseqno, ahdr.originator.u8[0], ahdr.originator.u8[1]);
+
+    if(ahdr.len > 0 && tc->cb->recv != NULL) {
+      tc->cb->recv(&ahdr.originator, ahdr.eseqno,
+                   packetbuf_attr(PACKETBUF_ATTR_HOPS));
+    }
   }
+  queuebuf_free(q);
 }
+#endif /* COLLECT_AGGREGATION */
 /*---------------------------------------------------------------------------*/
 static void
 node_packet_received(struct unicast_conn *c, const rimeaddr_t *from)
 {
   struct collect_conn *tc = (struct collect_conn *)
     ((char *)c - offsetof(struct collect_conn, unicast_conn));
-  int i;
   struct data_msg_hdr hdr;
   uint8_t ackflags = 0;
   struct collect_neighbor *n;
@@ -949,23 +1278,19 @@ node_packet_received(struct unicast_conn *c, const rimeaddr_t *from)
       ackflags |= ACK_FLAGS_CONGESTED;
     }
 
-    for(i = 0; i < NUM_RECENT_PACKETS; i++) {
-      if(recent_packets[i].conn == tc &&
-         recent_packets[i].eseqno == packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID) &&
-         rimeaddr_cmp(&recent_packets[i].originator,
-                      packetbuf_addr(PACKETBUF_ADDR_ESENDER))) {
-        /* This is a duplicate of a packet we recently received, so we
-           just send an ACK. */
-        PRINTF("%d.%d: found duplicate packet from %d.%d with seqno %d, via %d.%d\n",
-               rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1],
-               recent_packets[i].originator.u8[0], recent_packets[i].originator.u8[1],
-               packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID),
-               packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0],
-               packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1]);
-        send_ack(tc, &ack_to, ackflags);
-        stats.duprecv++;
-        return;
-      }
+    if(is_duplicate_packet(tc)) {
+      /* This is a duplicate of a packet we recently received, so we
+         just send an ACK. */
+      PRINTF("%d.%d: found duplicate packet from %d.%d with seqno %d, via %d.%d\n",
+             rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1],
+             packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[0],
+             packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[1],
+             packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID),
+             packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0],
+             packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1]);
+      send_ack(tc, &ack_to, ackflags);
+      stats.duprecv++;
+      return;
     }
 
     /* If we are the sink, the packet has reached its final
@@ -973,7 +1298,16 @@ node_packet_received(struct unicast_conn *c, const rimeaddr_t *from)
     if(tc->rtmetric == RTMETRIC_SINK) {
       struct queuebuf *q;
 
+#if COLLECT_AGGREGATION
+      /* The packets in an aggregated packet are checked for
+         duplicates and remembered one by one as they are
+         delivered. */
+      if((hdr.flags & DATA_FLAGS_AGGREGATE) == 0) {
+        add_packet_to_recent_packets(tc);
+      }
+#else /* COLLECT_AGGREGATION */
       add_packet_to_recent_packets(tc);
+#endif /* COLLECT_AGGREGATION */
 
       /* We first send the ACK. We copy the data packet to a queuebuf
          first. */
@@ -998,6 +1332,13 @@ node_packet_received(struct unicast_conn *c, const rimeaddr_t *from)
              packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[1],
              from->u8[0], from->u8[1]);
 
+#if COLLECT_AGGREGATION
+      if(hdr.flags & DATA_FLAGS_AGGREGATE) {
+        deliver_aggregate(tc);
+        return;
+      }
+#endif /* COLLECT_AGGREGATION */
+
       packetbuf_hdrreduce(sizeof(struct data_msg_hdr));
       /* Call receive function. */
       if(packetbuf_datalen() > 0 && tc->cb->recv != NULL) {
@@ -1439,6 +1780,7 @@ collect_send(struct collect_conn *tc, int rexmits)
 
     /* Allocate space for the header. */
     packetbuf_hdralloc(sizeof(struct data_msg_hdr));
+    memset(packetbuf_hdrptr(), 0, sizeof(struct data_msg_hdr));
 
     if(packetqueue_enqueue_packetbuf(&tc->send_queue,
                                      FORWARD_PACKET_LIFETIME_BASE *
@@ -1524,6 +1866,13 @@ collect_print_stats(void)
          stats.ackrecv, stats.badack, stats.duprecv,
          stats.qdrop, stats.rtdrop, stats.ttldrop, stats.ackdrop,
          stats.timedout);
+#if COLLECT_AGGREGATION
+  /* The aggregation ratio is the number of packets per aggregated
+     packet, aggpackets / aggsent. */
+  PRINTF("collect aggregation aggsent %lu aggpackets %lu aggrecv %lu aggdelivered %lu\n",
+         stats.aggsent, stats.aggpackets,
+         stats.aggrecv, stats.aggdelivered);
+#endif /* COLLECT_AGGREGATION */
 }
 /*---------------------------------------------------------------------------*/
 /** @} */
@@ -15,6 +15,15 @@
  * The collect module uses 2 channels; one for neighbor discovery and one
  * for data packets.
  *
+ * \section aggregation Aggregation
+ *
+ * If COLLECT_CONF_AGGREGATION is set, a node that has several
+ * packets queued for its parent sends them in one frame, with the
+ * originator, sequence number, and hop count of each packet stored
+ * in a small per-packet header. The frame is acknowledged as a
+ * whole. The sink unpacks the frame and calls the recv callback once
+ * for each packet.
+ *
  */
 
 /*
@@ -92,6 +101,17 @@ struct collect_callbacks {
 #define COLLECT_ANNOUNCEMENTS COLLECT_CONF_ANNOUNCEMENTS
 #endif /* COLLECT_CONF_ANNOUNCEMENTS */
 
+/* COLLECT_CONF_AGGREGATION defines if packets that are queued for
+   the same parent should be coalesced into a single frame. The sink
+   unpacks aggregated frames and calls the recv callback once for
+   every packet in the frame. All nodes in a network must use the same
+   setting. */
+#ifndef COLLECT_CONF_AGGREGATION
+#define COLLECT_AGGREGATION 0
+#else
+#define COLLECT_AGGREGATION COLLECT_CONF_AGGREGATION
+#endif /* COLLECT_CONF_AGGREGATION */
+
 struct collect_conn {
   struct unicast_conn unicast_conn;
 #if ! COLLECT_ANNOUNCEMENTS
@@ -53,6 +53,10 @@ struct rimestats {
     sendingdrop; /* Packet dropped when we were sending a packet */
 
   unsigned long lltx, llrx;
+
+  /* Frames left in the radio RX FIFO because the RX ring was full,
+     and overflows of the radio RX FIFO: */
+  unsigned long rxringfull, rxoverflow;
 };
 
 extern struct rimestats rimestats;
@@ -154,4 +154,45 @@
 #define RPL_DIO_REDUNDANCY          10
 #endif
 
+/*
+ * DAO aggregation. Instead of forwarding the DAOs of its children one
+ * by one, a router in storing mode collects their targets for at most
+ * RPL_DAO_AGGREGATION_WINDOW and sends them to its own parent in a
+ * single DAO, along with its own target.
+ */
+#ifdef RPL_CONF_DAO_AGGREGATION
+#define RPL_DAO_AGGREGATION         RPL_CONF_DAO_AGGREGATION
+#else
+#define RPL_DAO_AGGREGATION         1
+#endif
+
+#ifdef RPL_CONF_DAO_AGGREGATION_WINDOW
+#define RPL_DAO_AGGREGATION_WINDOW  RPL_CONF_DAO_AGGREGATION_WINDOW
+#else
+#define RPL_DAO_AGGREGATION_WINDOW  CLOCK_SECOND
+#endif
+
+/*
+ * The maximum number of targets in a DAO, including our own. Three
+ * targets and the DODAG ID fit in one 802.15.4 frame; larger values
+ * rely on 6LoWPAN fragmentation.
+ */
+#ifdef RPL_CONF_DAO_MAX_TARGETS
+#define RPL_DAO_MAX_TARGETS         RPL_CONF_DAO_MAX_TARGETS
+#else
+#define RPL_DAO_MAX_TARGETS         3
+#endif
+
+/*
+ * The number of nodes that the root keeps in non-storing mode. This
+ * includes the nodes that are only known as the parent of other
+ * nodes. By default, the root can reach as many nodes as it would
+ * have routes in storing mode.
+ */
+#ifdef RPL_NS_CONF_LINK_NUM
+#define RPL_NS_LINK_NUM             RPL_NS_CONF_LINK_NUM
+#else
+#define RPL_NS_LINK_NUM             UIP_DS6_ROUTE_NB
+#endif
+
 #endif /* RPL_CONF_H */
@@ -68,6 +68,17 @@ static rpl_of_t * const objective_functions[] = {&RPL_OF};
 #define RPL_MAX_PARENTS_PER_DAG       RPL_CONF_MAX_PARENTS_PER_DAG
 #endif /* !RPL_CONF_MAX_PARENTS_PER_DAG */
 
+/* The number of buckets in the parent address hash. Must be a power
+   of two. */
+#ifndef RPL_CONF_PARENT_HASH_SIZE
+#define RPL_PARENT_HASH_SIZE          8
+#else
+#define RPL_PARENT_HASH_SIZE          RPL_CONF_PARENT_HASH_SIZE
+#endif /* !RPL_CONF_PARENT_HASH_SIZE */
+
+#define PARENT_HASH(addr) \
+  (((addr)->u8[14] ^ (addr)->u8[15]) & (RPL_PARENT_HASH_SIZE - 1))
+
 /*---------------------------------------------------------------------------*/
 /* RPL definitions. */
 
@@ -81,6 +92,9 @@ static rpl_of_t * const objective_functions[] = {&RPL_OF};
 /* Allocate parents from the same static MEMB chunk to reduce memory waste. */
 MEMB(parent_memb, struct rpl_parent,
      RPL_MAX_PARENTS_PER_DAG * RPL_MAX_INSTANCES * RPL_MAX_DAG_PER_INSTANCE);
+
+/* The parents of all DAGs, hashed on their address. */
+static rpl_parent_t *parent_hash[RPL_PARENT_HASH_SIZE];
 /*---------------------------------------------------------------------------*/
 /* Allocate instance table. */
 rpl_instance_t instance_table[RPL_MAX_INSTANCES];
@@ -135,23 +149,56 @@ nullify_parents(rpl_dag_t *dag, rpl_rank_t minimum_rank)
   }
 }
 /*---------------------------------------------------------------------------*/
+/*
+ * Keep the parents of a DAG ordered by the rank that the OF computes
+ * through each of them, so that the best candidate is at the head of
+ * the list and the worst at its tail. Only the given parent is moved.
+ */
+static void
+order_parent(rpl_parent_t *parent)
+{
+  rpl_dag_t *dag;
+  rpl_parent_t *p, *prev;
+
+  dag = parent->dag;
+  if(parent->rank == INFINITE_RANK) {
+    parent->candidate_rank = INFINITE_RANK;
+  } else {
+    parent->candidate_rank = dag->instance->of->calculate_rank(parent, 0);
+  }
+
+  list_remove(dag->parents, parent);
+  prev = NULL;
+  for(p = list_head(dag->parents);
+      p != NULL && p->candidate_rank <= parent->candidate_rank;
+      p = p->next) {
+    prev = p;
+  }
+  list_insert(dag->parents, prev, parent);
+}
+/*---------------------------------------------------------------------------*/
+/* Make room for a candidate parent through which our rank would be
+   candidate_rank, if it is better than the worst parent in the set. */
 static void
-remove_worst_parent(rpl_dag_t *dag, rpl_rank_t min_worst_rank)
+remove_worst_parent(rpl_dag_t *dag, rpl_rank_t candidate_rank)
 {
   rpl_parent_t *p, *worst;
 
   PRINTF("RPL: Removing the worst parent\n");
 
-  /* Find the parent with the highest rank. */
+  /* The worst parent is at the tail of the set, unless a parent has
+     lost its rank since it was last ordered. */
   worst = NULL;
-  for(p = list_head(dag->parents); p != NULL; p = list_item_next(p)) {
-    if(p != dag->preferred_parent &&
-       (worst == NULL || p->rank > worst->rank)) {
+  for(p = list_head(dag->parents); p != NULL; p = p->next) {
+    if(p != dag->preferred_parent) {
       worst = p;
+      if(p->rank == INFINITE_RANK) {
+        break;
+      }
     }
   }
-  /* Remove the neighbor if its rank is worse than the minimum worst rank. */
-  if(worst != NULL && worst->rank > min_worst_rank) {
+  if(worst != NULL &&
+     (worst->rank == INFINITE_RANK || worst->candidate_rank > candidate_rank)) {
     rpl_remove_parent(dag, worst);
   }
 }
@@ -476,6 +523,9 @@ rpl_free_dag(rpl_dag_t *dag)
 
     /* Remove routes installed by DAOs. */
     rpl_remove_routes(dag);
+#if RPL_WITH_NON_STORING
+    rpl_ns_remove_nodes(dag);
+#endif /* RPL_WITH_NON_STORING */
 
    /* Remove autoconfigured address */
     if((dag->prefix_info.flags & UIP_ND6_RA_FLAG_AUTONOMOUS)) {
@@ -507,7 +557,11 @@ rpl_add_parent(rpl_dag_t *dag, rpl_dio_t *dio, uip_ipaddr_t *addr)
   p->dtsn = dio->dtsn;
   p->link_metric = INITIAL_LINK_METRIC;
   memcpy(&p->mc, &dio->mc, sizeof(p->mc));
+  /* The parent is ordered when its first parent event is processed. */
+  p->candidate_rank = INFINITE_RANK;
   list_add(dag->parents, p);
+  p->hash_next = parent_hash[PARENT_HASH(addr)];
+  parent_hash[PARENT_HASH(addr)] = p;
   return p;
 }
 /*---------------------------------------------------------------------------*/
@@ -516,49 +570,35 @@ rpl_find_parent(rpl_dag_t *dag, uip_ipaddr_t *addr)
 {
   rpl_parent_t *p;
 
-  for(p = list_head(dag->parents); p != NULL; p = p->next) {
-    if(uip_ipaddr_cmp(&p->addr, addr)) {
+  for(p = parent_hash[PARENT_HASH(addr)]; p != NULL; p = p->hash_next) {
+    if(p->dag == dag && uip_ipaddr_cmp(&p->addr, addr)) {
       return p;
     }
   }
   return NULL;
 }
-
 /*---------------------------------------------------------------------------*/
-static rpl_dag_t *
-find_parent_dag(rpl_instance_t *instance, uip_ipaddr_t *addr)
+rpl_parent_t *
+rpl_find_parent_any_dag(rpl_instance_t *instance, uip_ipaddr_t *addr)
 {
   rpl_parent_t *p;
-  rpl_dag_t *dag, *end;
 
-  for(dag = &instance->dag_table[0], end = dag + RPL_MAX_DAG_PER_INSTANCE; dag < end; ++dag) {
-    if(dag->used) {
-      for(p = list_head(dag->parents); p != NULL; p = p->next) {
-        if(uip_ipaddr_cmp(&p->addr, addr)) {
-          return dag;
-        }
-      }
+  for(p = parent_hash[PARENT_HASH(addr)]; p != NULL; p = p->hash_next) {
+    if(p->dag->instance == instance && p->dag->used &&
+       uip_ipaddr_cmp(&p->addr, addr)) {
+      return p;
     }
   }
   return NULL;
 }
 /*---------------------------------------------------------------------------*/
-rpl_parent_t *
-rpl_find_parent_any_dag(rpl_instance_t *instance, uip_ipaddr_t *addr)
+static rpl_dag_t *
+find_parent_dag(rpl_instance_t *instance, uip_ipaddr_t *addr)
 {
-  static rpl_parent_t *p;
-  static rpl_dag_t *dag, *end;
+  rpl_parent_t *p;
 
-  for(dag = &instance->dag_table[0], end = dag + RPL_MAX_DAG_PER_INSTANCE; dag < end; ++dag) {
-    if(dag->used) {
-      for(p = list_head(dag->parents); p != NULL; p = p->next) {
-        if(uip_ipaddr_cmp(&p->addr, addr)) {
-          return p;
-        }
-      }
-    }
-  }
-  return NULL;
+  p = rpl_find_parent_any_dag(instance, addr);
+  return p != NULL ? p->dag : NULL;
 }
 /*---------------------------------------------------------------------------*/
 rpl_dag_t *
@@ -657,15 +697,16 @@ rpl_select_parent(rpl_dag_t *dag)
 {
   rpl_parent_t *p, *best;
 
-  best = NULL;
-  for(p = list_head(dag->parents); p != NULL; p = p->next) {
-    if(p->rank == INFINITE_RANK) {
-      /* ignore this neighbor */
-    } else if(best == NULL) {
-      best = p;
-    } else {
-      best = dag->instance->of->best_parent(best, p);
-    }
+  /* The parent set is ordered, so the first parent with a valid rank
+     is the best candidate. The OF decides whether it is worth leaving
+     the current preferred parent for it. */
+  for(best = list_head(dag->parents);
+      best != NULL && best->rank == INFINITE_RANK;
+      best = best->next);
+
+  p = dag->preferred_parent;
+  if(best != NULL && p != NULL && p != best && p->rank != INFINITE_RANK) {
+    best = dag->instance->of->best_parent(p, best);
   }
 
   if(best != NULL) {
@@ -678,12 +719,21 @@ rpl_select_parent(rpl_dag_t *dag)
 void
 rpl_remove_parent(rpl_dag_t *dag, rpl_parent_t *parent)
 {
+  rpl_parent_t **pp;
+
   rpl_nullify_parent(dag, parent);
 
   PRINTF("RPL: Removing parent ");
   PRINT6ADDR(&parent->addr);
   PRINTF("\n");
 
+  for(pp = &parent_hash[PARENT_HASH(&parent->addr)]; *pp != NULL;
+      pp = &(*pp)->hash_next) {
+    if(*pp == parent) {
+      *pp = parent->hash_next;
+      break;
+    }
+  }
   list_remove(dag->parents, parent);
   memb_free(&parent_memb, parent);
 }
@@ -737,6 +787,7 @@ rpl_move_parent(rpl_dag_t *dag_src, rpl_dag_t *dag_dst, rpl_parent_t *parent)
   list_remove(dag_src->parents, parent);
   parent->dag = dag_dst;
   list_add(dag_dst->parents, parent);
+  order_parent(parent);
 }
 /*---------------------------------------------------------------------------*/
 rpl_dag_t *
@@ -851,6 +902,7 @@ rpl_join_instance(uip_ipaddr_t *from, rpl_dio_t *dio)
   memcpy(&dag->prefix_info, &dio->prefix_info, sizeof(rpl_prefix_t));
 
   dag->preferred_parent = p;
+  order_parent(p);
   instance->of->update_metric_container(instance);
   dag->rank = instance->of->calculate_rank(p, 0);
   /* So far this is the lowest rank we are aware of. */
@@ -1048,6 +1100,8 @@ rpl_process_parent_event(rpl_instance_t *instance, rpl_parent_t *p)
   old_rank = instance->current_dag->rank;
   return_value = 1;
 
+  order_parent(p);
+
   if(!acceptable_rank(p->dag, p->rank)) {
     /* The candidate parent is no longer valid: the rank increase resulting
        from the choice of it as a parent would be too high. */
@@ -1172,7 +1226,7 @@ rpl_process_dio(uip_ipaddr_t *from, rpl_dio_t *dio)
     if(previous_dag == NULL) {
       if(RPL_PARENT_COUNT(dag) == RPL_MAX_PARENTS_PER_DAG) {
         /* Make room for a new parent. */
-        remove_worst_parent(dag, dio->rank);
+        remove_worst_parent(dag, instance->of->calculate_rank(NULL, dio->rank));
       }
       /* Add the DIO sender as a candidate parent. */
       p = rpl_add_parent(dag, dio, from);
@@ -61,6 +61,8 @@
 #define UIP_EXT_HDR_OPT_BUF       ((struct uip_ext_hdr_opt *)&uip_buf[uip_l2_l3_hdr_len + uip_ext_opt_offset])
 #define UIP_EXT_HDR_OPT_PADN_BUF  ((struct uip_ext_hdr_opt_padn *)&uip_buf[uip_l2_l3_hdr_len + uip_ext_opt_offset])
 #define UIP_EXT_HDR_OPT_RPL_BUF   ((struct uip_ext_hdr_opt_rpl *)&uip_buf[uip_l2_l3_hdr_len + uip_ext_opt_offset])
+#define UIP_RH_BUF                ((struct uip_routing_hdr *)&uip_buf[uip_l2_l3_hdr_len])
+#define UIP_SRH_OUT_BUF           ((uint8_t *)&uip_buf[UIP_LLH_LEN + UIP_IPH_LEN])
 /*---------------------------------------------------------------------------*/
 int
 rpl_verify_header(int uip_ext_opt_offset)
@@ -313,3 +315,197 @@ rpl_invert_header(void)
   }
 }
 /*---------------------------------------------------------------------------*/
+int
+rpl_process_srh_header(void)
+{
+  uint8_t *srh;
+  uint8_t cmpri, cmpre, cmpr, pad;
+  int addr_len, n, i;
+  uip_ipaddr_t next;
+
+  if(UIP_RH_BUF->routing_type != RPL_RH_TYPE_SRH) {
+    return 0;
+  }
+
+  srh = (uint8_t *)UIP_RH_BUF;
+  cmpri = srh[4] >> 4;
+  cmpre = srh[4] & 0x0f;
+  pad = srh[5] >> 4;
+
+  addr_len = ((UIP_RH_BUF->len + 1) << 3) - RPL_SRH_LEN - pad;
+  if(addr_len < 16 - cmpre) {
+    PRINTF("RPL: Malformed source routing header\n");
+    return 0;
+  }
+  n = (addr_len - (16 - cmpre)) / (16 - cmpri) + 1;
+  if(UIP_RH_BUF->seg_left > n) {
+    PRINTF("RPL: Source routing header with too many segments left\n");
+    return 0;
+  }
+
+  /* The elided prefix of the next address is shared with the current
+     destination address. */
+  i = n - UIP_RH_BUF->seg_left;
+  cmpr = i == n - 1 ? cmpre : cmpri;
+  uip_ipaddr_copy(&next, &UIP_IP_BUF->destipaddr);
+  memcpy(&next.u8[cmpr], srh + RPL_SRH_LEN + i * (16 - cmpri), 16 - cmpr);
+
+  if(uip_is_addr_mcast(&next) || uip_ds6_is_my_addr(&next)) {
+    PRINTF("RPL: Loop in the source routing header\n");
+    return 0;
+  }
+
+  uip_ipaddr_copy(&UIP_IP_BUF->destipaddr, &next);
+  UIP_RH_BUF->seg_left--;
+
+  PRINTF("RPL: Source routing to ");
+  PRINT6ADDR(&next);
+  PRINTF(", %u segments left\n", UIP_RH_BUF->seg_left);
+
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+#if RPL_WITH_NON_STORING
+static uint8_t
+common_prefix(rpl_ns_node_t *a, rpl_ns_node_t *b)
+{
+  uint8_t i;
+
+  for(i = 0; i < sizeof(a->link_identifier) - 1 &&
+        a->link_identifier[i] == b->link_identifier[i]; i++);
+  return RPL_NS_PREFIX_LEN + i;
+}
+/*---------------------------------------------------------------------------*/
+static int
+insert_srh_header(void)
+{
+  rpl_dag_t *dag;
+  rpl_ns_node_t *dest;
+  rpl_ns_node_t *root;
+  rpl_ns_node_t *first;
+  rpl_ns_node_t *n;
+  uip_ipaddr_t addr;
+  uint8_t *srh;
+  uint8_t cmpri, cmpre, cmpr, pad;
+  int hops, addr_len, len, pos;
+  uint16_t plen;
+
+  if(default_instance == NULL || !default_instance->used ||
+     default_instance->mop != RPL_MOP_NON_STORING) {
+    return 0;
+  }
+  dag = default_instance->current_dag;
+  if(!dag->joined || dag->rank != ROOT_RANK(default_instance)) {
+    return 0;
+  }
+
+  dest = rpl_ns_get_node(dag, &UIP_IP_BUF->destipaddr);
+  root = rpl_ns_get_node(dag, &dag->dag_id);
+  if(dest == NULL || root == NULL || dest == root) {
+    return 0;
+  }
+
+  /* Walk the parent pointers up to the root. The node closest to the
+     root becomes the destination of the packet. */
+  hops = 0;
+  first = NULL;
+  for(n = dest; n != root; n = n->parent) {
+    if(n == NULL || ++hops > RPL_NS_LINK_NUM) {
+      PRINTF("RPL: No source route to ");
+      PRINT6ADDR(&UIP_IP_BUF->destipaddr);
+      PRINTF("\n");
+      uip_len = 0;
+      return 1;
+    }
+    first = n;
+  }
+
+  /* The packet is routed by its source route from now on, so the RPL
+     option is no longer needed. */
+  rpl_remove_header();
+
+  if(hops == 1) {
+    /* The destination is a child of the root. */
+    return 1;
+  }
+
+  /* Every address is elided against the previous hop at the receiver.
+     The intermediate hops all share cmpri bytes with the first hop, and
+     so with each other, but the last one only shares cmpri bytes with
+     its predecessor: cmpre must not be longer than cmpri. */
+  cmpre = common_prefix(dest, first);
+  if(hops > 2) {
+    cmpri = 15;
+    for(n = dest->parent; n != first; n = n->parent) {
+      cmpr = common_prefix(n, first);
+      if(cmpr < cmpri) {
+        cmpri = cmpr;
+      }
+    }
+    if(cmpre > cmpri) {
+      cmpre = cmpri;
+    }
+  } else {
+    cmpri = cmpre;
+  }
+
+  addr_len = (hops - 2) * (16 - cmpri) + (16 - cmpre);
+  pad = (8 - (addr_len & 7)) & 7;
+  len = RPL_SRH_LEN + addr_len + pad;
+  if(uip_len + len > UIP_LINK_MTU ||
+     uip_len + len > UIP_BUFSIZE - UIP_LLH_LEN) {
+    PRINTF("RPL: Packet too long: impossible to add source routing header\n");
+    uip_len = 0;
+    return 1;
+  }
+
+  srh = UIP_SRH_OUT_BUF;
+  memmove(srh + len, srh, uip_len - UIP_IPH_LEN);
+  memset(srh, 0, len);
+  srh[0] = UIP_IP_BUF->proto;
+  srh[1] = (len >> 3) - 1;
+  srh[2] = RPL_RH_TYPE_SRH;
+  srh[3] = hops - 1;
+  srh[4] = (cmpri << 4) | cmpre;
+  srh[5] = pad << 4;
+  UIP_IP_BUF->proto = UIP_PROTO_ROUTING;
+
+  /* Fill in the addresses backwards, from the final destination
+     towards the root. */
+  pos = RPL_SRH_LEN + addr_len;
+  for(n = dest; n != first; n = n->parent) {
+    cmpr = n == dest ? cmpre : cmpri;
+    pos -= 16 - cmpr;
+    rpl_ns_get_node_global_addr(&addr, n);
+    memcpy(srh + pos, &addr.u8[cmpr], 16 - cmpr);
+  }
+  rpl_ns_get_node_global_addr(&UIP_IP_BUF->destipaddr, first);
+
+  uip_len += len;
+  plen = ((uint16_t)UIP_IP_BUF->len[0] << 8) + UIP_IP_BUF->len[1] + len;
+  UIP_IP_BUF->len[0] = plen >> 8;
+  UIP_IP_BUF->len[1] = plen & 0xff;
+
+  PRINTF("RPL: Source routing %d hops through ", hops);
+  PRINT6ADDR(&UIP_IP_BUF->destipaddr);
+  PRINTF("\n");
+
+  return 1;
+}
+#endif /* RPL_WITH_NON_STORING */
+/*---------------------------------------------------------------------------*/
+int
+rpl_update_header_srh(void)
+{
+  if(UIP_IP_BUF->proto == UIP_PROTO_ROUTING &&
+     ((struct uip_routing_hdr *)UIP_SRH_OUT_BUF)->routing_type == RPL_RH_TYPE_SRH) {
+    /* The packet is already on its source route. */
+    return 1;
+  }
+#if RPL_WITH_NON_STORING
+  return insert_srh_header();
+#else /* RPL_WITH_NON_STORING */
+  return 0;
+#endif /* RPL_WITH_NON_STORING */
+}
+/*---------------------------------------------------------------------------*/
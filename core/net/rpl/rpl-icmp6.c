@@ -546,6 +546,134 @@ dio_output(rpl_instance_t *instance, uip_ipaddr_t *uc_addr)
 #endif /* RPL_LEAF_ONLY */
 }
 /*---------------------------------------------------------------------------*/
+static int
+dao_target_input(rpl_instance_t *instance, unsigned char *target,
+                 uint8_t lifetime, int learned_from)
+{
+  rpl_dag_t *dag;
+  uip_ds6_route_t *rep;
+  uint8_t prefixlen;
+
+  dag = instance->current_dag;
+
+  prefixlen = target[3];
+  memset(&prefix, 0, sizeof(prefix));
+  memcpy(&prefix, target + 4, (prefixlen + 7) / CHAR_BIT);
+
+  PRINTF("RPL: DAO lifetime: %u, prefix length: %u prefix: ",
+          (unsigned)lifetime, (unsigned)prefixlen);
+  PRINT6ADDR(&prefix);
+  PRINTF("\n");
+
+  rep = uip_ds6_route_lookup(&prefix);
+
+  if(lifetime == RPL_ZERO_LIFETIME) {
+    /* No-Path DAO received; invoke the route purging routine. */
+    if(rep != NULL && rep->state.saved_lifetime == 0 && rep->length == prefixlen) {
+      PRINTF("RPL: Setting expiration timer for prefix ");
+      PRINT6ADDR(&prefix);
+      PRINTF("\n");
+      rep->state.saved_lifetime = rep->state.lifetime;
+      rep->state.lifetime = DAO_EXPIRATION_TIMEOUT;
+      rep->state.dao_pending = RPL_ROUTE_DAO_NONE;
+    }
+    return RPL_DAO_ACK_UNCONDITIONAL_ACCEPT;
+  }
+
+  rep = rpl_add_route(dag, &prefix, prefixlen, &dao_sender_addr);
+  if(rep == NULL) {
+    RPL_STAT(rpl_stats.mem_overflows++);
+    PRINTF("RPL: Could not add a route after receiving a DAO\n");
+    return RPL_DAO_ACK_UNABLE_TO_ACCEPT;
+  }
+
+  rep->state.lifetime = RPL_LIFETIME(instance, lifetime);
+  rep->state.learned_from = learned_from;
+  /* A target that was removed by a No-Path DAO has registered again,
+     so its route no longer expires and it is reported upwards again. */
+  rep->state.saved_lifetime = 0;
+#if RPL_DAO_AGGREGATION
+  if(learned_from == RPL_ROUTE_FROM_UNICAST_DAO &&
+     dag->rank != ROOT_RANK(instance)) {
+    /* Forwarded in the next DAO to our own parent. */
+    rep->state.dao_pending = RPL_ROUTE_DAO_PENDING;
+  }
+#endif /* RPL_DAO_AGGREGATION */
+
+  return RPL_DAO_ACK_UNCONDITIONAL_ACCEPT;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Handles the target options in buffer[start..end), which share one
+ * transit information option. Returns -1 if the DAO must be dropped,
+ * and the DAO-ACK status otherwise.
+ */
+static int
+dao_targets_input(rpl_instance_t *instance, unsigned char *buffer,
+                  int start, int end, uint8_t lifetime, int learned_from,
+                  uip_ipaddr_t *parent)
+{
+  rpl_dag_t *dag;
+  rpl_parent_t *p;
+  int status;
+  int i;
+  int len;
+
+  dag = instance->current_dag;
+  status = RPL_DAO_ACK_UNCONDITIONAL_ACCEPT;
+
+#if RPL_WITH_NON_STORING
+  if(instance->mop == RPL_MOP_NON_STORING) {
+    if(parent == NULL) {
+      PRINTF("RPL: Ignoring a non-storing DAO without a parent\n");
+      return -1;
+    }
+    for(i = start; i < end; i += len) {
+      len = buffer[i] == RPL_OPTION_PAD1 ? 1 : 2 + buffer[i + 1];
+      if(buffer[i] != RPL_OPTION_TARGET) {
+        continue;
+      }
+      memset(&prefix, 0, sizeof(prefix));
+      memcpy(&prefix, buffer + i + 4, (buffer[i + 3] + 7) / CHAR_BIT);
+      if(lifetime == RPL_ZERO_LIFETIME) {
+        rpl_ns_expire_parent(dag, &prefix, parent);
+      } else if(rpl_ns_update_node(dag, &prefix, parent,
+                                   RPL_LIFETIME(instance, lifetime)) == NULL) {
+        RPL_STAT(rpl_stats.mem_overflows++);
+        PRINTF("RPL: Could not add a node after receiving a DAO\n");
+        status = RPL_DAO_ACK_UNABLE_TO_ACCEPT;
+      }
+    }
+    return status;
+  }
+#endif /* RPL_WITH_NON_STORING */
+
+  if(lifetime != RPL_ZERO_LIFETIME &&
+     learned_from == RPL_ROUTE_FROM_UNICAST_DAO) {
+    /* Check whether this is a DAO forwarding loop. */
+    p = rpl_find_parent(dag, &dao_sender_addr);
+    /* check if this is a new DAO registration with an "illegal" rank */
+    /* if we already route to this node it is likely */
+    if(p != NULL && DAG_RANK(p->rank, instance) < DAG_RANK(dag->rank, instance)) {
+      PRINTF("RPL: Loop detected when receiving a unicast DAO from a node with a lower rank! (%u < %u)\n",
+          DAG_RANK(p->rank, instance), DAG_RANK(dag->rank, instance));
+      p->rank = INFINITE_RANK;
+      p->updated = 1;
+      return -1;
+    }
+  }
+
+  for(i = start; i < end; i += len) {
+    len = buffer[i] == RPL_OPTION_PAD1 ? 1 : 2 + buffer[i + 1];
+    if(buffer[i] == RPL_OPTION_TARGET &&
+       dao_target_input(instance, buffer + i, lifetime, learned_from) !=
+       RPL_DAO_ACK_UNCONDITIONAL_ACCEPT) {
+      status = RPL_DAO_ACK_UNABLE_TO_ACCEPT;
+    }
+  }
+  return status;
+}
+/*---------------------------------------------------------------------------*/
 static void
 dao_input(void)
 {
@@ -555,20 +683,23 @@ dao_input(void)
   static uint16_t sequence;
   static uint8_t instance_id;
   static uint8_t lifetime;
-  static uint8_t prefixlen;
   uint8_t flags;
   uint8_t subopt_type;
   uint8_t pathcontrol;
   uint8_t pathsequence;
-  uip_ds6_route_t *rep;
   static uint8_t buffer_length;
   static int pos;
   int len;
   int i;
+  int group;
   int learned_from;
-  rpl_parent_t *p;
-
-  prefixlen = 0;
+  int advertised;
+  int status;
+  int result;
+  uip_ipaddr_t *parent;
+#if RPL_WITH_NON_STORING
+  uip_ipaddr_t parent_addr;
+#endif /* RPL_WITH_NON_STORING */
 
   uip_ipaddr_copy(&dao_sender_addr, &UIP_IP_BUF->srcipaddr);
 
@@ -609,9 +740,28 @@ dao_input(void)
     /* Perhaps, there are verification to do but ... */
   }
 
-  /* Check if there are any RPL options present. */
-  i = pos;
-  for(; i < buffer_length; i += len) {
+#if RPL_WITH_NON_STORING
+  if(instance->mop == RPL_MOP_NON_STORING &&
+     dag->rank != ROOT_RANK(instance)) {
+    /* Only the root stores the DODAG in non-storing mode. */
+    PRINTF("RPL: Ignoring a non-storing DAO\n");
+    return;
+  }
+#endif /* RPL_WITH_NON_STORING */
+
+  learned_from = uip_is_addr_mcast(&dao_sender_addr) ?
+                 RPL_ROUTE_FROM_MULTICAST_DAO : RPL_ROUTE_FROM_UNICAST_DAO;
+  status = RPL_DAO_ACK_UNCONDITIONAL_ACCEPT;
+  advertised = 0;
+  parent = NULL;
+
+  /*
+   * A DAO carries one or more groups of target options. Each group is
+   * followed by the transit information option that applies to all
+   * targets in it.
+   */
+  group = 0;
+  for(i = pos; i < buffer_length; i += len) {
     subopt_type = buffer[i];
     if(subopt_type == RPL_OPTION_PAD1) {
       len = 1;
@@ -622,68 +772,66 @@ dao_input(void)
 
     switch(subopt_type) {
     case RPL_OPTION_TARGET:
-      /* Handle the target option. */
-      prefixlen = buffer[i + 3];
-      memset(&prefix, 0, sizeof(prefix));
-      memcpy(&prefix, buffer + i + 4, (prefixlen + 7) / CHAR_BIT);
+      if(group == 0) {
+        group = i;
+      }
       break;
     case RPL_OPTION_TRANSIT:
       /* The path sequence and control are ignored. */
       pathcontrol = buffer[i + 3];
       pathsequence = buffer[i + 4];
       lifetime = buffer[i + 5];
-      /* The parent address is also ignored. */
+#if RPL_WITH_NON_STORING
+      /* In non-storing mode, the transit option carries the address
+         of the parent of the targets. */
+      if(len >= 6 + sizeof(parent_addr)) {
+        memcpy(&parent_addr, buffer + i + 6, sizeof(parent_addr));
+        parent = &parent_addr;
+      }
+#endif /* RPL_WITH_NON_STORING */
+      if(group != 0) {
+        result = dao_targets_input(instance, buffer, group, i, lifetime,
+                                   learned_from, parent);
+        if(result < 0) {
+          return;
+        }
+        status |= result;
+        advertised |= lifetime != RPL_ZERO_LIFETIME;
+        group = 0;
+      }
       break;
     }
   }
 
-  PRINTF("RPL: DAO lifetime: %u, prefix length: %u prefix: ",
-          (unsigned)lifetime, (unsigned)prefixlen);
-  PRINT6ADDR(&prefix);
-  PRINTF("\n");
-
-  rep = uip_ds6_route_lookup(&prefix);
-
-  if(lifetime == RPL_ZERO_LIFETIME) {
-    /* No-Path DAO received; invoke the route purging routine. */
-    if(rep != NULL && rep->state.saved_lifetime == 0 && rep->length == prefixlen) {
-      PRINTF("RPL: Setting expiration timer for prefix ");
-      PRINT6ADDR(&prefix);
-      PRINTF("\n");
-      rep->state.saved_lifetime = rep->state.lifetime;
-      rep->state.lifetime = DAO_EXPIRATION_TIMEOUT;
-    }
-    return;
-  }
-
-  learned_from = uip_is_addr_mcast(&dao_sender_addr) ?
-                 RPL_ROUTE_FROM_MULTICAST_DAO : RPL_ROUTE_FROM_UNICAST_DAO;
-
-  if(learned_from == RPL_ROUTE_FROM_UNICAST_DAO) {
-    /* Check whether this is a DAO forwarding loop. */
-    p = rpl_find_parent(dag, &dao_sender_addr);
-    /* check if this is a new DAO registration with an "illegal" rank */
-    /* if we already route to this node it is likely */
-    if(p != NULL && DAG_RANK(p->rank, instance) < DAG_RANK(dag->rank, instance)) {
-      PRINTF("RPL: Loop detected when receiving a unicast DAO from a node with a lower rank! (%u < %u)\n",
-          DAG_RANK(p->rank, instance), DAG_RANK(dag->rank, instance));
-      p->rank = INFINITE_RANK;
-      p->updated = 1;
+  if(group != 0) {
+    /* Targets without a transit option get the default lifetime. */
+    lifetime = instance->default_lifetime;
+    result = dao_targets_input(instance, buffer, group, buffer_length,
+                               lifetime, learned_from, parent);
+    if(result < 0) {
       return;
     }
+    status |= result;
+    advertised = 1;
   }
 
-  rep = rpl_add_route(dag, &prefix, prefixlen, &dao_sender_addr);
-  if(rep == NULL) {
-    RPL_STAT(rpl_stats.mem_overflows++);
-    PRINTF("RPL: Could not add a route after receiving a DAO\n");
+#if RPL_WITH_NON_STORING
+  if(instance->mop == RPL_MOP_NON_STORING) {
+    if(flags & RPL_DAO_K_FLAG) {
+      dao_ack_output(instance, &dao_sender_addr, sequence, status);
+    }
     return;
   }
-
-  rep->state.lifetime = RPL_LIFETIME(instance, lifetime);
-  rep->state.learned_from = learned_from;
-
-  if(learned_from == RPL_ROUTE_FROM_UNICAST_DAO) {
+#endif /* RPL_WITH_NON_STORING */
+
+  if(advertised && learned_from == RPL_ROUTE_FROM_UNICAST_DAO) {
+#if RPL_DAO_AGGREGATION
+    /* The targets are sent to our parent together with our own and
+       those of our other children. */
+    if(dag->rank != ROOT_RANK(instance)) {
+      rpl_schedule_aggregated_dao(instance);
+    }
+#else /* RPL_DAO_AGGREGATION */
     if(dag->preferred_parent) {
       PRINTF("RPL: Forwarding DAO to parent ");
       PRINT6ADDR(&dag->preferred_parent->addr);
@@ -691,11 +839,71 @@ dao_input(void)
       uip_icmp6_send(&dag->preferred_parent->addr,
                      ICMP6_RPL, RPL_CODE_DAO, buffer_length);
     }
+#endif /* RPL_DAO_AGGREGATION */
     if(flags & RPL_DAO_K_FLAG) {
-      dao_ack_output(instance, &dao_sender_addr, sequence);
+      dao_ack_output(instance, &dao_sender_addr, sequence, status);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+add_target_option(unsigned char *buffer, int pos, uip_ipaddr_t *target,
+                  uint8_t prefixlen)
+{
+  buffer[pos++] = RPL_OPTION_TARGET;
+  buffer[pos++] = 2 + ((prefixlen + 7) / CHAR_BIT);
+  buffer[pos++] = 0; /* reserved */
+  buffer[pos++] = prefixlen;
+  memcpy(buffer + pos, target, (prefixlen + 7) / CHAR_BIT);
+  return pos + ((prefixlen + 7) / CHAR_BIT);
+}
+/*---------------------------------------------------------------------------*/
+#if RPL_DAO_AGGREGATION
+static int
+add_pending_targets(rpl_dag_t *dag, unsigned char *buffer, int pos,
+                    int *targets)
+{
+  uip_ds6_route_t *r;
+  int state;
+
+  /* Targets that have not been sent yet go first; targets that are
+     still waiting for a DAO-ACK fill the remaining room. */
+  for(state = RPL_ROUTE_DAO_PENDING; state <= RPL_ROUTE_DAO_SENT; state++) {
+    for(r = uip_ds6_route_list_head();
+        r != NULL && *targets < RPL_DAO_MAX_TARGETS;
+        r = list_item_next(r)) {
+      if(r->state.dag != dag || r->state.dao_pending != state ||
+         r->state.saved_lifetime != 0 ||
+         (state == RPL_ROUTE_DAO_SENT && r->state.dao_seqno == dao_sequence)) {
+        continue;
+      }
+      pos = add_target_option(buffer, pos, &r->ipaddr, r->length);
+#if RPL_CONF_DAO_ACK
+      r->state.dao_pending = RPL_ROUTE_DAO_SENT;
+      r->state.dao_seqno = dao_sequence;
+#else /* RPL_CONF_DAO_ACK */
+      r->state.dao_pending = RPL_ROUTE_DAO_NONE;
+#endif /* RPL_CONF_DAO_ACK */
+      (*targets)++;
+    }
+  }
+  return pos;
+}
+/*---------------------------------------------------------------------------*/
+static int
+has_pending_targets(rpl_dag_t *dag)
+{
+  uip_ds6_route_t *r;
+
+  for(r = uip_ds6_route_list_head(); r != NULL; r = list_item_next(r)) {
+    if(r->state.dag == dag && r->state.dao_pending == RPL_ROUTE_DAO_PENDING &&
+       r->state.saved_lifetime == 0) {
+      return 1;
     }
   }
+  return 0;
 }
+#endif /* RPL_DAO_AGGREGATION */
 /*---------------------------------------------------------------------------*/
 void
 dao_output(rpl_parent_t *n, uint8_t lifetime)
@@ -703,8 +911,9 @@ dao_output(rpl_parent_t *n, uint8_t lifetime)
   rpl_dag_t *dag;
   rpl_instance_t *instance;
   unsigned char *buffer;
-  uint8_t prefixlen;
   int pos;
+  int targets;
+  uip_ipaddr_t *dest;
 
   /* Destination Advertisement Object */
 
@@ -742,13 +951,17 @@ dao_output(rpl_parent_t *n, uint8_t lifetime)
 #endif /* RPL_DAO_SPECIFY_DAG */
 
   /* create target subopt */
-  prefixlen = sizeof(prefix) * CHAR_BIT;
-  buffer[pos++] = RPL_OPTION_TARGET;
-  buffer[pos++] = 2 + ((prefixlen + 7) / CHAR_BIT);
-  buffer[pos++] = 0; /* reserved */
-  buffer[pos++] = prefixlen;
-  memcpy(buffer + pos, &prefix, (prefixlen + 7) / CHAR_BIT);
-  pos += ((prefixlen + 7) / CHAR_BIT);
+  pos = add_target_option(buffer, pos, &prefix, sizeof(prefix) * CHAR_BIT);
+  targets = 1;
+
+#if RPL_DAO_AGGREGATION
+  /* Append the targets learned from our children since the last DAO.
+     They share the transit information option below. A No-Path DAO
+     only withdraws our own target from the old parent. */
+  if(lifetime != RPL_ZERO_LIFETIME && instance->mop != RPL_MOP_NON_STORING) {
+    pos = add_pending_targets(dag, buffer, pos, &targets);
+  }
+#endif /* RPL_DAO_AGGREGATION */
 
   /* Create a transit information sub-option. */
   buffer[pos++] = RPL_OPTION_TRANSIT;
@@ -757,14 +970,35 @@ dao_output(rpl_parent_t *n, uint8_t lifetime)
   buffer[pos++] = 0; /* path control - ignored */
   buffer[pos++] = 0; /* path seq - ignored */
   buffer[pos++] = lifetime;
+  dest = &n->addr;
+
+#if RPL_WITH_NON_STORING
+  if(instance->mop == RPL_MOP_NON_STORING) {
+    /* Report the global address of the parent, formed from the DAG
+       prefix, and send the DAO end to end to the root. */
+    buffer[pos - 5] += sizeof(uip_ipaddr_t); /* option length */
+    memcpy(buffer + pos, &dag->prefix_info.prefix, RPL_NS_PREFIX_LEN);
+    memcpy(buffer + pos + RPL_NS_PREFIX_LEN, &n->addr.u8[RPL_NS_PREFIX_LEN],
+           sizeof(uip_ipaddr_t) - RPL_NS_PREFIX_LEN);
+    pos += sizeof(uip_ipaddr_t);
+    dest = &dag->dag_id;
+  }
+#endif /* RPL_WITH_NON_STORING */
 
   PRINTF("RPL: Sending DAO with prefix ");
   PRINT6ADDR(&prefix);
-  PRINTF(" to ");
-  PRINT6ADDR(&n->addr);
+  PRINTF(" and %d other targets to ", targets - 1);
+  PRINT6ADDR(dest);
   PRINTF("\n");
 
-  uip_icmp6_send(&n->addr, ICMP6_RPL, RPL_CODE_DAO, pos);
+  uip_icmp6_send(dest, ICMP6_RPL, RPL_CODE_DAO, pos);
+
+#if RPL_DAO_AGGREGATION
+  if(lifetime != RPL_ZERO_LIFETIME && has_pending_targets(dag)) {
+    /* Not all targets fit in this DAO. */
+    rpl_schedule_aggregated_dao(instance);
+  }
+#endif /* RPL_DAO_AGGREGATION */
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -775,6 +1009,9 @@ dao_ack_input(void)
   uint8_t instance_id;
   uint8_t sequence;
   uint8_t status;
+#if RPL_DAO_AGGREGATION
+  uip_ds6_route_t *r;
+#endif /* RPL_DAO_AGGREGATION */
 
   buffer = UIP_ICMP_PAYLOAD;
   buffer_length = uip_len - uip_l3_icmp_hdr_len;
@@ -787,14 +1024,29 @@ dao_ack_input(void)
     sequence, status);
   PRINT6ADDR(&UIP_IP_BUF->srcipaddr);
   PRINTF("\n");
+
+#if RPL_DAO_AGGREGATION
+  /* The DAO-ACK covers all targets that were sent in the DAO. If the
+     parent could not accept them, they are retried in the next DAO. */
+  if(status < RPL_DAO_ACK_UNABLE_TO_ACCEPT) {
+    for(r = uip_ds6_route_list_head(); r != NULL; r = list_item_next(r)) {
+      if(r->state.dao_pending == RPL_ROUTE_DAO_SENT &&
+         r->state.dao_seqno == sequence) {
+        r->state.dao_pending = RPL_ROUTE_DAO_NONE;
+      }
+    }
+  }
+#endif /* RPL_DAO_AGGREGATION */
 }
 /*---------------------------------------------------------------------------*/
 void
-dao_ack_output(rpl_instance_t *instance, uip_ipaddr_t *dest, uint8_t sequence)
+dao_ack_output(rpl_instance_t *instance, uip_ipaddr_t *dest, uint8_t sequence,
+               uint8_t status)
 {
   unsigned char *buffer;
 
-  PRINTF("RPL: Sending a DAO ACK with sequence number %d to ", sequence);
+  PRINTF("RPL: Sending a DAO ACK with sequence number %d and status %d to ",
+         sequence, status);
   PRINT6ADDR(dest);
   PRINTF("\n");
 
@@ -803,7 +1055,7 @@ dao_ack_output(rpl_instance_t *instance, uip_ipaddr_t *dest, uint8_t sequence)
   buffer[0] = instance->instance_id;
   buffer[1] = 0;
   buffer[2] = sequence;
-  buffer[3] = 0;
+  buffer[3] = status;
 
   uip_icmp6_send(dest, ICMP6_RPL, RPL_CODE_DAO_ACK, 4);
 }
@@ -0,0 +1,234 @@
+/**
+ * \addtogroup uip6
+ * @{
+ */
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+/**
+ * \file
+ *         The DODAG of a RPL root in non-storing mode.
+ *
+ *         In non-storing mode, every node reports its preferred parent
+ *         to the root in its DAOs. The root keeps one entry per node
+ *         with a pointer to the entry of its parent, from which it
+ *         builds the source routes for downward traffic. Only the
+ *         interface identifier of a node is stored; the prefix is
+ *         taken from the DAG.
+ */
+
+#include "net/uip.h"
+#include "net/uip-ds6.h"
+#include "net/rpl/rpl-private.h"
+#include "lib/list.h"
+#include "lib/memb.h"
+
+#define DEBUG DEBUG_NONE
+#include "net/uip-debug.h"
+
+#include <string.h>
+
+#if RPL_WITH_NON_STORING
+
+MEMB(node_memb, rpl_ns_node_t, RPL_NS_LINK_NUM);
+LIST(nodes);
+/*---------------------------------------------------------------------------*/
+static int
+has_dag_prefix(rpl_dag_t *dag, const uip_ipaddr_t *addr)
+{
+  return memcmp(addr, &dag->prefix_info.prefix, RPL_NS_PREFIX_LEN) == 0;
+}
+/*---------------------------------------------------------------------------*/
+static rpl_ns_node_t *
+lookup(rpl_dag_t *dag, const uip_ipaddr_t *addr)
+{
+  rpl_ns_node_t *n;
+
+  for(n = list_head(nodes); n != NULL; n = n->next) {
+    if(n->dag == dag &&
+       memcmp(n->link_identifier, &addr->u8[RPL_NS_PREFIX_LEN],
+              sizeof(n->link_identifier)) == 0) {
+      return n;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static rpl_ns_node_t *
+add(rpl_dag_t *dag, const uip_ipaddr_t *addr)
+{
+  rpl_ns_node_t *n;
+
+  n = lookup(dag, addr);
+  if(n != NULL) {
+    return n;
+  }
+
+  n = memb_alloc(&node_memb);
+  if(n == NULL) {
+    return NULL;
+  }
+  memset(n, 0, sizeof(*n));
+  n->dag = dag;
+  memcpy(n->link_identifier, &addr->u8[RPL_NS_PREFIX_LEN],
+         sizeof(n->link_identifier));
+  list_add(nodes, n);
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+static void
+set_parent(rpl_ns_node_t *n, rpl_ns_node_t *parent)
+{
+  if(n->parent != NULL) {
+    n->parent->children--;
+  }
+  n->parent = parent;
+  if(parent != NULL) {
+    parent->children++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_node(rpl_ns_node_t *n)
+{
+  set_parent(n, NULL);
+  list_remove(nodes, n);
+  memb_free(&node_memb, n);
+}
+/*---------------------------------------------------------------------------*/
+rpl_ns_node_t *
+rpl_ns_update_node(rpl_dag_t *dag, const uip_ipaddr_t *child,
+                   const uip_ipaddr_t *parent, uint32_t lifetime)
+{
+  rpl_ns_node_t *c;
+  rpl_ns_node_t *p;
+
+  if(!has_dag_prefix(dag, child) || !has_dag_prefix(dag, parent)) {
+    PRINTF("RPL: DAO target or parent outside the DAG prefix\n");
+    return NULL;
+  }
+
+  c = add(dag, child);
+  if(c == NULL) {
+    return NULL;
+  }
+  p = add(dag, parent);
+  if(p == NULL) {
+    if(c->lifetime == 0 && c->children == 0) {
+      remove_node(c);
+    }
+    return NULL;
+  }
+
+  set_parent(c, p);
+  c->lifetime = lifetime;
+
+  PRINTF("RPL: Node ");
+  PRINT6ADDR(child);
+  PRINTF(" has parent ");
+  PRINT6ADDR(parent);
+  PRINTF(" (lifetime %lu)\n", (unsigned long)lifetime);
+
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+void
+rpl_ns_expire_parent(rpl_dag_t *dag, const uip_ipaddr_t *child,
+                     const uip_ipaddr_t *parent)
+{
+  rpl_ns_node_t *c;
+
+  c = lookup(dag, child);
+  /* Ignore a No-Path DAO for a link that has already been replaced. */
+  if(c != NULL && c->parent != NULL && c->parent == lookup(dag, parent)) {
+    set_parent(c, NULL);
+    c->lifetime = 0;
+  }
+}
+/*---------------------------------------------------------------------------*/
+rpl_ns_node_t *
+rpl_ns_get_node(rpl_dag_t *dag, const uip_ipaddr_t *addr)
+{
+  if(!has_dag_prefix(dag, addr)) {
+    return NULL;
+  }
+  return lookup(dag, addr);
+}
+/*---------------------------------------------------------------------------*/
+void
+rpl_ns_get_node_global_addr(uip_ipaddr_t *addr, rpl_ns_node_t *n)
+{
+  memcpy(addr, &n->dag->prefix_info.prefix, RPL_NS_PREFIX_LEN);
+  memcpy(&addr->u8[RPL_NS_PREFIX_LEN], n->link_identifier,
+         sizeof(n->link_identifier));
+}
+/*---------------------------------------------------------------------------*/
+int
+rpl_ns_num_nodes(void)
+{
+  return list_length(nodes);
+}
+/*---------------------------------------------------------------------------*/
+void
+rpl_ns_periodic(void)
+{
+  rpl_ns_node_t *n;
+  rpl_ns_node_t *next;
+
+  for(n = list_head(nodes); n != NULL; n = next) {
+    next = n->next;
+    if(n->lifetime > 0) {
+      n->lifetime--;
+    }
+    /* Nodes that only appear as the parent of other nodes, such as
+       the root itself, are kept for as long as they have children. */
+    if(n->lifetime == 0 && n->children == 0) {
+      remove_node(n);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+rpl_ns_remove_nodes(rpl_dag_t *dag)
+{
+  rpl_ns_node_t *n;
+  rpl_ns_node_t *next;
+
+  for(n = list_head(nodes); n != NULL; n = next) {
+    next = n->next;
+    if(n->dag == dag) {
+      list_remove(nodes, n);
+      memb_free(&node_memb, n);
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+#endif /* RPL_WITH_NON_STORING */
@@ -89,6 +89,10 @@
 
 #define RPL_DAO_K_FLAG                   0x80 /* DAO ACK requested */
 #define RPL_DAO_D_FLAG                   0x40 /* DODAG ID present */
+
+/* DAO-ACK status values. Values from 128 reject the DAO. */
+#define RPL_DAO_ACK_UNCONDITIONAL_ACCEPT 0
+#define RPL_DAO_ACK_UNABLE_TO_ACCEPT     128
 /*---------------------------------------------------------------------------*/
 /* RPL IPv6 extension header option. */
 #define RPL_HDR_OPT_LEN			4
@@ -99,6 +103,10 @@
 #define RPL_HDR_OPT_RANK_ERR_SHIFT   	6
 #define RPL_HDR_OPT_FWD_ERR		0x20
 #define RPL_HDR_OPT_FWD_ERR_SHIFT   	5
+
+/* RPL Source Routing Header (RFC 6554). */
+#define RPL_RH_TYPE_SRH			3
+#define RPL_SRH_LEN			8
 /*---------------------------------------------------------------------------*/
 /* Default values for RPL constants and variables. */
 
@@ -177,6 +185,11 @@
 #define RPL_ROUTE_FROM_MULTICAST_DAO    2
 #define RPL_ROUTE_FROM_DIO              3
 
+/* Whether a route has yet to be advertised to our own parent. */
+#define RPL_ROUTE_DAO_NONE              0
+#define RPL_ROUTE_DAO_PENDING           1
+#define RPL_ROUTE_DAO_SENT              2 /* Waiting for a DAO-ACK */
+
 /* DAG Mode of Operation */
 #define RPL_MOP_NO_DOWNWARD_ROUTES      0
 #define RPL_MOP_NON_STORING             1
@@ -189,6 +202,9 @@
 #define RPL_MOP_DEFAULT                 RPL_MOP_STORING_NO_MULTICAST
 #endif
 
+/* In non-storing mode, only the root keeps downward routes. */
+#define RPL_WITH_NON_STORING            (RPL_MOP_DEFAULT == RPL_MOP_NON_STORING)
+
 /*
  * The ETX in the metric container is expressed as a fixed-point value 
  * whose integer part can be obtained by dividing the value by 
@@ -266,6 +282,33 @@ extern rpl_stats_t rpl_stats;
 #define RPL_STAT(code)
 #endif /* RPL_CONF_STATS */
 /*---------------------------------------------------------------------------*/
+#if RPL_WITH_NON_STORING
+/* The length of the DAG prefix shared by the nodes of a non-storing
+   DODAG. */
+#define RPL_NS_PREFIX_LEN               8
+
+/* A node in the DODAG of a non-storing root. */
+struct rpl_ns_node {
+  struct rpl_ns_node *next;
+  rpl_dag_t *dag;
+  struct rpl_ns_node *parent;
+  uint32_t lifetime;
+  uint8_t children;
+  unsigned char link_identifier[16 - RPL_NS_PREFIX_LEN];
+};
+typedef struct rpl_ns_node rpl_ns_node_t;
+
+rpl_ns_node_t *rpl_ns_update_node(rpl_dag_t *dag, const uip_ipaddr_t *child,
+                                  const uip_ipaddr_t *parent, uint32_t lifetime);
+void rpl_ns_expire_parent(rpl_dag_t *dag, const uip_ipaddr_t *child,
+                          const uip_ipaddr_t *parent);
+rpl_ns_node_t *rpl_ns_get_node(rpl_dag_t *dag, const uip_ipaddr_t *addr);
+void rpl_ns_get_node_global_addr(uip_ipaddr_t *addr, rpl_ns_node_t *n);
+int rpl_ns_num_nodes(void);
+void rpl_ns_periodic(void);
+void rpl_ns_remove_nodes(rpl_dag_t *dag);
+#endif /* RPL_WITH_NON_STORING */
+/*---------------------------------------------------------------------------*/
 /* Instances */
 extern rpl_instance_t instance_table[];
 extern rpl_instance_t *default_instance;
@@ -274,7 +317,7 @@ extern rpl_instance_t *default_instance;
 void dis_output(uip_ipaddr_t *addr);
 void dio_output(rpl_instance_t *, uip_ipaddr_t *uc_addr);
 void dao_output(rpl_parent_t *, uint8_t lifetime);
-void dao_ack_output(rpl_instance_t *, uip_ipaddr_t *, uint8_t);
+void dao_ack_output(rpl_instance_t *, uip_ipaddr_t *, uint8_t, uint8_t);
 
 /* RPL logic functions. */
 void rpl_join_dag(uip_ipaddr_t *from, rpl_dio_t *dio);
@@ -312,6 +355,9 @@ rpl_of_t *rpl_find_of(rpl_ocp_t);
 
 /* Timer functions. */
 void rpl_schedule_dao(rpl_instance_t *);
+#if RPL_DAO_AGGREGATION
+void rpl_schedule_aggregated_dao(rpl_instance_t *);
+#endif /* RPL_DAO_AGGREGATION */
 void rpl_reset_dio_timer(rpl_instance_t *);
 void rpl_reset_periodic_timer(void);
 
@@ -64,6 +64,9 @@ static void
 handle_periodic_timer(void *ptr)
 {
   rpl_purge_routes();
+#if RPL_WITH_NON_STORING
+  rpl_ns_periodic();
+#endif /* RPL_WITH_NON_STORING */
   rpl_recalculate_ranks();
 
   /* handle DIS */
@@ -205,6 +208,9 @@ handle_dao_timer(void *ptr)
     return;
   }
 
+  /* Stopped first, as dao_output() may schedule another DAO. */
+  ctimer_stop(&instance->dao_timer);
+
   /* Send the DAO to the DAO parent set -- the preferred parent in our case. */
   if(instance->current_dag->preferred_parent != NULL) {
     PRINTF("RPL: handle_dao_timer - sending DAO\n");
@@ -213,7 +219,6 @@ handle_dao_timer(void *ptr)
   } else {
     PRINTF("RPL: No suitable DAO parent\n");
   }
-  ctimer_stop(&instance->dao_timer);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -235,3 +240,26 @@ rpl_schedule_dao(rpl_instance_t *instance)
   }
 }
 /*---------------------------------------------------------------------------*/
+#if RPL_DAO_AGGREGATION
+void
+rpl_schedule_aggregated_dao(rpl_instance_t *instance)
+{
+  clock_time_t expiration_time;
+
+  /* Targets learned from children go out with the next DAO, but no
+     later than at the end of the aggregation window. */
+  if(!etimer_expired(&instance->dao_timer.etimer) &&
+     (clock_time_t)(etimer_expiration_time(&instance->dao_timer.etimer) -
+                    clock_time()) <= RPL_DAO_AGGREGATION_WINDOW) {
+    PRINTF("RPL: Aggregating targets into the scheduled DAO\n");
+  } else {
+    expiration_time = RPL_DAO_AGGREGATION_WINDOW / 2 +
+      (random_rand() % (RPL_DAO_AGGREGATION_WINDOW / 2 + 1));
+    PRINTF("RPL: Scheduling aggregated DAO %u ticks in the future\n",
+           (unsigned)expiration_time);
+    ctimer_set(&instance->dao_timer, expiration_time,
+               handle_dao_timer, instance);
+  }
+}
+#endif /* RPL_DAO_AGGREGATION */
+/*---------------------------------------------------------------------------*/
@@ -109,10 +109,12 @@ struct rpl_dag;
 /*---------------------------------------------------------------------------*/
 struct rpl_parent {
   struct rpl_parent *next;
+  struct rpl_parent *hash_next;
   struct rpl_dag *dag;
   rpl_metric_container_t mc;
   uip_ipaddr_t addr;
   rpl_rank_t rank;
+  rpl_rank_t candidate_rank; /* Our rank through this parent. */
   uint8_t link_metric;
   uint8_t dtsn;
   uint8_t updated;
@@ -241,5 +243,7 @@ int rpl_update_header_final(uip_ipaddr_t *addr);
 int rpl_verify_header(int);
 void rpl_remove_header(void);
 uint8_t rpl_invert_header(void);
+int rpl_process_srh_header(void);
+int rpl_update_header_srh(void);
 /*---------------------------------------------------------------------------*/
 #endif /* RPL_H */
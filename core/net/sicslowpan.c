@@ -66,7 +66,9 @@
 #include "net/rime.h"
 #include "net/sicslowpan.h"
 #include "net/neighbor-info.h"
+#include "net/link-stats.h"
 #include "net/netstack.h"
+#include "sys/trace.h"
 
 #define DEBUG 0
 #if DEBUG
@@ -1317,6 +1319,9 @@ packet_sent(void *ptr, int status, int transmissions)
 {
 #if SICSLOWPAN_CONF_NEIGHBOR_INFO
   neighbor_info_packet_sent(status, transmissions);
+#else /* SICSLOWPAN_CONF_NEIGHBOR_INFO */
+  link_stats_packet_sent(packetbuf_addr(PACKETBUF_ADDR_RECEIVER),
+                         status, transmissions);
 #endif /* SICSLOWPAN_CONF_NEIGHBOR_INFO */
   if(callback != NULL) {
     callback->output_callback(status);
@@ -1402,6 +1407,10 @@ output(uip_lladdr_t *localdest)
             (UIP_TCP_BUF->flags & TCP_FIN) == TCP_FIN) {
     packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
                        PACKETBUF_ATTR_PACKET_TYPE_STREAM_END);
+  } else if(UIP_IP_BUF->proto == UIP_PROTO_ICMP6) {
+    /* Neighbor discovery and RPL signaling. */
+    packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE,
+                       PACKETBUF_ATTR_PACKET_TYPE_CONTROL);
   }
 
   /*
@@ -1417,6 +1426,7 @@ output(uip_lladdr_t *localdest)
   
   PRINTFO("sicslowpan output: sending packet len %d\n", uip_len);
 
+  TRACE_BEGIN(TRACE_sicslowpan_compress);
   if(uip_len >= COMPRESSION_THRESHOLD) {
     /* Try to compress the headers */
 #if SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC1
@@ -1431,6 +1441,7 @@ output(uip_lladdr_t *localdest)
   } else {
     compress_hdr_ipv6(&dest);
   }
+  TRACE_END(TRACE_sicslowpan_compress);
   PRINTFO("sicslowpan output: header of len %d\n", rime_hdr_len);
 
   if(uip_len - uncomp_hdr_len > MAC_MAX_PAYLOAD - rime_hdr_len) {
@@ -1686,7 +1697,9 @@ input(void)
 #if SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC06
   if((RIME_HC1_PTR[RIME_HC1_DISPATCH] & 0xe0) == SICSLOWPAN_DISPATCH_IPHC) {
     PRINTFI("sicslowpan input: IPHC\n");
+    TRACE_BEGIN(TRACE_sicslowpan_uncompress);
     uncompress_hdr_hc06(frag_size);
+    TRACE_END(TRACE_sicslowpan_uncompress);
   } else
 #endif /* SICSLOWPAN_COMPRESSION == SICSLOWPAN_COMPRESSION_HC06 */
     switch(RIME_HC1_PTR[RIME_HC1_DISPATCH]) {
@@ -1784,6 +1797,8 @@ input(void)
 
 #if SICSLOWPAN_CONF_NEIGHBOR_INFO
     neighbor_info_packet_received();
+#else /* SICSLOWPAN_CONF_NEIGHBOR_INFO */
+    link_stats_input_callback(packetbuf_addr(PACKETBUF_ADDR_SENDER));
 #endif /* SICSLOWPAN_CONF_NEIGHBOR_INFO */
 
     /* if callback is set then set attributes and call */
@@ -41,6 +41,7 @@
 #include "contiki-net.h"
 #include "net/uip-split.h"
 #include "net/uip-packetqueue.h"
+#include "sys/trace.h"
 
 #if UIP_CONF_IPV6
 #include "net/uip-nd6.h"
@@ -526,6 +527,7 @@ eventhandler(process_event_t ev, process_data_t data)
 void
 tcpip_input(void)
 {
+  TRACE_BEGIN(TRACE_tcpip_input);
 #if NETSTACK_CONF_SHORTCUTS
 /* calling process_post_sync, adds many bytes onto stack with the
  * only affect being process.c::process_current modified and restored
@@ -535,6 +537,7 @@ tcpip_input(void)
 #else
   process_post_synch(&tcpip_process, PACKET_INPUT, NULL);
 #endif
+  TRACE_END(TRACE_tcpip_input);
   uip_len = 0;
 #if UIP_CONF_IPV6
   uip_ext_len = 0;
@@ -571,8 +574,17 @@ tcpip_ipv6_output(void)
       nexthop = &UIP_IP_BUF->destipaddr;
     } else {
       uip_ds6_route_t* locrt;
-      locrt = uip_ds6_route_lookup(&UIP_IP_BUF->destipaddr);
-      if(locrt == NULL) {
+#if UIP_CONF_IPV6_RPL
+      if(rpl_update_header_srh()) {
+        /* The packet follows an RPL source route, on which the
+           destination address is the next hop. */
+        if(uip_len == 0) {
+          return;
+        }
+        nexthop = &UIP_IP_BUF->destipaddr;
+      } else
+#endif /* UIP_CONF_IPV6_RPL */
+      if((locrt = uip_ds6_route_lookup(&UIP_IP_BUF->destipaddr)) == NULL) {
         if((nexthop = uip_ds6_defrt_choose()) == NULL) {
 #ifdef UIP_FALLBACK_INTERFACE
 	  PRINTF("FALLBACK: removing ext hdrs & setting proto %d %d\n", 
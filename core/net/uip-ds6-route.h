@@ -77,6 +77,8 @@ typedef struct rpl_route_entry {
   uint32_t saved_lifetime;
   void *dag;
   uint8_t learned_from;
+  uint8_t dao_pending;
+  uint8_t dao_seqno;
 } rpl_route_entry_t;
 #endif /* UIP_DS6_ROUTE_STATE_TYPE */
 
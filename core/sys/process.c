@@ -44,9 +44,12 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "sys/process.h"
 #include "sys/arg.h"
+#include "sys/trace.h"
+#include "sys/rtimer.h"
 
 /*
  * Pointer to the currently running process structure.
@@ -63,6 +66,9 @@ struct event_data {
   process_event_t ev;
   process_data_t data;
   struct process *p;
+#if PROCESS_ACCOUNTING
+  rtimer_clock_t posted;
+#endif /* PROCESS_ACCOUNTING */
 };
 
 static process_num_events_t nevents, fevent;
@@ -72,6 +78,15 @@ static struct event_data events[PROCESS_CONF_NUMEVENTS];
 process_num_events_t process_maxevents;
 #endif
 
+#if PROCESS_ACCOUNTING
+/* The time that the process being called has spent in synchronous
+   calls to other processes. */
+static rtimer_clock_t called_time;
+/* The time that the event being delivered waited in the queue. */
+static rtimer_clock_t event_wait;
+static struct process *event_receiver = PROCESS_ZOMBIE;
+#endif /* PROCESS_ACCOUNTING */
+
 static volatile unsigned char poll_requested;
 
 #define PROCESS_STATE_NONE        0
@@ -171,10 +186,40 @@ exit_process(struct process *p, struct process *fromprocess)
   process_current = old_current;
 }
 /*---------------------------------------------------------------------------*/
+#if PROCESS_ACCOUNTING
+static void
+account_wait(struct process *p, rtimer_clock_t wait)
+{
+  rtimer_clock_t limit;
+  int bin;
+
+  limit = PROCESS_ACCOUNTING_BIN_TICKS;
+  for(bin = 0; bin < PROCESS_ACCOUNTING_BINS - 1 && wait >= limit; bin++) {
+    limit <<= 1;
+  }
+  if(p->accounting.wait[bin] < 0xffff) {
+    p->accounting.wait[bin]++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+process_accounting_reset(void)
+{
+  struct process *p;
+
+  for(p = process_list; p != NULL; p = p->next) {
+    memset(&p->accounting, 0, sizeof(p->accounting));
+  }
+}
+/*---------------------------------------------------------------------------*/
+#endif /* PROCESS_ACCOUNTING */
 static void
 call_process(struct process *p, process_event_t ev, process_data_t data)
 {
   int ret;
+#if PROCESS_ACCOUNTING
+  rtimer_clock_t start, elapsed, outer_called_time;
+#endif /* PROCESS_ACCOUNTING */
 
 #if DEBUG
   if(p->state == PROCESS_STATE_CALLED) {
@@ -187,7 +232,27 @@ call_process(struct process *p, process_event_t ev, process_data_t data)
     PRINTF("process: calling process '%s' with event %d\n", PROCESS_NAME_STRING(p), ev);
     process_current = p;
     p->state = PROCESS_STATE_CALLED;
+#if PROCESS_ACCOUNTING
+    if(p == event_receiver || event_receiver == PROCESS_BROADCAST) {
+      account_wait(p, event_wait);
+    }
+    event_receiver = PROCESS_ZOMBIE;
+    outer_called_time = called_time;
+    called_time = 0;
+    start = RTIMER_NOW();
+#endif /* PROCESS_ACCOUNTING */
+    TRACE_BEGIN(TRACE_process_call);
     ret = p->thread(&p->pt, ev, data);
+    TRACE_END(TRACE_process_call);
+#if PROCESS_ACCOUNTING
+    elapsed = RTIMER_NOW() - start;
+    p->accounting.invocations++;
+    p->accounting.time += elapsed - called_time;
+    if(elapsed - called_time > p->accounting.max_time) {
+      p->accounting.max_time = elapsed - called_time;
+    }
+    called_time = outer_called_time + elapsed;
+#endif /* PROCESS_ACCOUNTING */
     if(ret == PT_EXITED ||
        ret == PT_ENDED ||
        ev == PROCESS_EVENT_EXIT) {
@@ -265,6 +330,9 @@ do_event(void)
     
     data = events[fevent].data;
     receiver = events[fevent].p;
+#if PROCESS_ACCOUNTING
+    event_wait = RTIMER_NOW() - events[fevent].posted;
+#endif /* PROCESS_ACCOUNTING */
 
     /* Since we have seen the new event, we move pointer upwards
        and decrese the number of events. */
@@ -281,7 +349,13 @@ do_event(void)
 	if(poll_requested) {
 	  do_poll();
 	}
+#if PROCESS_ACCOUNTING
+	event_receiver = PROCESS_BROADCAST;
+#endif /* PROCESS_ACCOUNTING */
 	call_process(p, ev, data);
+#if PROCESS_ACCOUNTING
+	event_receiver = PROCESS_ZOMBIE;
+#endif /* PROCESS_ACCOUNTING */
       }
     } else {
       /* This is not a broadcast event, so we deliver it to the
@@ -292,8 +366,14 @@ do_event(void)
 	receiver->state = PROCESS_STATE_RUNNING;
       }
 
+#if PROCESS_ACCOUNTING
+      event_receiver = receiver;
+#endif /* PROCESS_ACCOUNTING */
       /* Make sure that the process actually is running. */
       call_process(receiver, ev, data);
+#if PROCESS_ACCOUNTING
+      event_receiver = PROCESS_ZOMBIE;
+#endif /* PROCESS_ACCOUNTING */
     }
   }
 }
@@ -347,6 +427,9 @@ process_post(struct process *p, process_event_t ev, process_data_t data)
   events[snum].ev = ev;
   events[snum].data = data;
   events[snum].p = p;
+#if PROCESS_ACCOUNTING
+  events[snum].posted = RTIMER_NOW();
+#endif /* PROCESS_ACCOUNTING */
   ++nevents;
 
 #if PROCESS_CONF_STATS
@@ -103,6 +103,42 @@ typedef unsigned char process_num_events_t;
 #define PROCESS_BROADCAST NULL
 #define PROCESS_ZOMBIE ((struct process *)0x1)
 
+/*
+ * With PROCESS_CONF_ACCOUNTING, every process keeps track of the time
+ * it has run, the number of times it has been invoked, its longest
+ * single invocation, and a histogram of the time that the events
+ * posted to it have waited in the event queue. Times are in rtimer
+ * ticks. Bin i of the histogram counts the waits shorter than
+ * PROCESS_ACCOUNTING_BIN_TICKS << i, and the last bin counts the
+ * rest.
+ */
+#ifdef PROCESS_CONF_ACCOUNTING
+#define PROCESS_ACCOUNTING PROCESS_CONF_ACCOUNTING
+#else /* PROCESS_CONF_ACCOUNTING */
+#define PROCESS_ACCOUNTING 0
+#endif /* PROCESS_CONF_ACCOUNTING */
+
+#ifdef PROCESS_CONF_ACCOUNTING_BINS
+#define PROCESS_ACCOUNTING_BINS PROCESS_CONF_ACCOUNTING_BINS
+#else /* PROCESS_CONF_ACCOUNTING_BINS */
+#define PROCESS_ACCOUNTING_BINS 8
+#endif /* PROCESS_CONF_ACCOUNTING_BINS */
+
+#ifdef PROCESS_CONF_ACCOUNTING_BIN_TICKS
+#define PROCESS_ACCOUNTING_BIN_TICKS PROCESS_CONF_ACCOUNTING_BIN_TICKS
+#else /* PROCESS_CONF_ACCOUNTING_BIN_TICKS */
+/* About a millisecond. */
+#define PROCESS_ACCOUNTING_BIN_TICKS \
+  (RTIMER_SECOND >= 1024 ? RTIMER_SECOND / 1024 : 1)
+#endif /* PROCESS_CONF_ACCOUNTING_BIN_TICKS */
+
+struct process_accounting {
+  unsigned long time;
+  unsigned long invocations;
+  unsigned long max_time;
+  unsigned short wait[PROCESS_ACCOUNTING_BINS];
+};
+
 /**
  * \name Process protothread functions
  * @{
@@ -323,6 +359,9 @@ struct process {
   PT_THREAD((* thread)(struct pt *, process_event_t, process_data_t));
   struct pt pt;
   unsigned char state, needspoll;
+#if PROCESS_ACCOUNTING
+  struct process_accounting accounting;
+#endif /* PROCESS_ACCOUNTING */
 };
 
 /**
@@ -521,6 +560,43 @@ int process_nevents(void);
 
 /** @} */
 
+#if PROCESS_ACCOUNTING
+/**
+ * \name Process accounting
+ * @{
+ */
+
+/**
+ * The time that a process has run, in rtimer ticks. The time that a
+ * process spends in a synchronous event to another process is counted
+ * for the other process.
+ */
+#define process_accounting_time(p) ((p)->accounting.time)
+
+/**
+ * The number of times that a process has been invoked.
+ */
+#define process_accounting_invocations(p) ((p)->accounting.invocations)
+
+/**
+ * The longest single invocation of a process, in rtimer ticks.
+ */
+#define process_accounting_max_time(p) ((p)->accounting.max_time)
+
+/**
+ * The number of events that have waited in the event queue for the
+ * range of times of a bin of the histogram.
+ */
+#define process_accounting_wait(p, bin) ((p)->accounting.wait[bin])
+
+/**
+ * Reset the accounting of all processes.
+ */
+void process_accounting_reset(void);
+
+/** @} */
+#endif /* PROCESS_ACCOUNTING */
+
 CCIF extern struct process *process_list;
 
 #define PROCESS_LIST() process_list
@@ -41,7 +41,8 @@
 #define __PROFILE_H__
 
 /* XXX: the profiling code is under development and may not work at
-   present. */
+   present. New code should use the trace in sys/trace.h, which records
+   numeric events instead of strings. */
 
 #define TIMETABLE_WITH_TYPE 1
 #include "sys/timetable.h"
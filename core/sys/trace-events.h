@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         The list of trace events.
+ *
+ *         Every TRACE_EVENT(name) line below defines the event
+ *         TRACE_name, numbered in the order of the list. The file is
+ *         included by sys/trace.h to build the enumeration, and read
+ *         by tools/trace/trace-decode to name the events in a trace,
+ *         so it must contain nothing but TRACE_EVENT() lines and
+ *         comments.
+ *
+ *         A project adds its own events by pointing
+ *         TRACE_CONF_PROJECT_EVENTS to a file in the same format,
+ *         which is appended to the list, and passing the same file
+ *         to trace-decode.
+ */
+
+TRACE_EVENT(process_call)
+TRACE_EVENT(tcpip_input)
+TRACE_EVENT(sicslowpan_compress)
+TRACE_EVENT(sicslowpan_uncompress)
+
+#ifdef TRACE_CONF_PROJECT_EVENTS
+#include TRACE_CONF_PROJECT_EVENTS
+#endif /* TRACE_CONF_PROJECT_EVENTS */
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A binary trace of spans and events, kept in a ring buffer.
+ */
+
+#include "sys/trace.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static struct trace_record records[TRACE_SIZE];
+
+/* Free-running indices of the next record to write and the oldest
+   record that has not been drained. */
+static uint16_t head, tail;
+static uint16_t dropped;
+
+#define TIME_BITS (sizeof(rtimer_clock_t) < 4 ? sizeof(rtimer_clock_t) * 8 : 32)
+/*---------------------------------------------------------------------------*/
+/*
+ * Records may be taken from interrupt handlers. A record that is
+ * interrupted by another one, or that is taken while the trace is
+ * being drained, can end up garbled or lost, which the decoder
+ * tolerates.
+ */
+void
+trace_record(uint8_t event, uint8_t kind)
+{
+  struct trace_record *r;
+
+  r = &records[head & (TRACE_SIZE - 1)];
+  r->time = RTIMER_NOW();
+  r->process = (uint16_t)(unsigned long)PROCESS_CURRENT();
+  r->event = event;
+  r->kind = kind;
+  head++;
+  if((uint16_t)(head - tail) > TRACE_SIZE) {
+    /* The oldest record was overwritten. */
+    tail++;
+    dropped++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+trace_pending(void)
+{
+  return (uint16_t)(head - tail);
+}
+/*---------------------------------------------------------------------------*/
+static uint8_t *
+put16(uint8_t *p, uint16_t v)
+{
+  *p++ = v >> 8;
+  *p++ = v & 0xff;
+  return p;
+}
+/*---------------------------------------------------------------------------*/
+static uint8_t *
+put32(uint8_t *p, uint32_t v)
+{
+  p = put16(p, v >> 16);
+  return put16(p, v & 0xffff);
+}
+/*---------------------------------------------------------------------------*/
+int
+trace_drain(uint8_t *buf, int len)
+{
+  struct trace_record *r;
+  uint8_t *p;
+  uint16_t n;
+  int count;
+
+  n = head - tail;
+  count = (len - TRACE_CHUNK_HDR_LEN) / TRACE_RECORD_LEN;
+  if(count > n) {
+    count = n;
+  }
+  if(count > 255) {
+    count = 255;
+  }
+  if(count <= 0 && dropped == 0) {
+    return 0;
+  }
+  if(count < 0) {
+    count = 0;
+  }
+
+  p = buf;
+  *p++ = TRACE_CHUNK_RECORDS;
+  *p++ = count;
+  p = put16(p, dropped);
+  p = put32(p, RTIMER_SECOND);
+  *p++ = TIME_BITS;
+  dropped = 0;
+
+  for(n = 0; n < count; n++) {
+    r = &records[tail & (TRACE_SIZE - 1)];
+    p = put32(p, (uint32_t)r->time);
+    p = put16(p, r->process);
+    *p++ = r->event;
+    *p++ = r->kind;
+    tail++;
+  }
+
+  return p - buf;
+}
+/*---------------------------------------------------------------------------*/
+int
+trace_describe_process(uint8_t *buf, int len, struct process *proc)
+{
+  const char *name;
+  uint8_t *p;
+  int n;
+
+  if(len < 4) {
+    return 0;
+  }
+  name = PROCESS_NAME_STRING(proc);
+  n = strlen(name);
+  if(n > len - 4) {
+    n = len - 4;
+  }
+  if(n > 255) {
+    n = 255;
+  }
+  p = buf;
+  *p++ = TRACE_CHUNK_PROCESS;
+  p = put16(p, (uint16_t)(unsigned long)proc);
+  *p++ = n;
+  memcpy(p, name, n);
+  return n + 4;
+}
+/*---------------------------------------------------------------------------*/
+static void
+print_chunk(const uint8_t *buf, int len)
+{
+  int i;
+
+  printf("trace ");
+  for(i = 0; i < len; i++) {
+    printf("%02x", buf[i]);
+  }
+  printf("\n");
+}
+/*---------------------------------------------------------------------------*/
+void
+trace_print(void)
+{
+  uint8_t buf[TRACE_CHUNK_HDR_LEN + 8 * TRACE_RECORD_LEN];
+  struct process *p;
+  int len;
+
+  for(p = PROCESS_LIST(); p != NULL; p = p->next) {
+    print_chunk(buf, trace_describe_process(buf, sizeof(buf), p));
+  }
+  while((len = trace_drain(buf, sizeof(buf))) > 0) {
+    print_chunk(buf, len);
+  }
+}
+/*---------------------------------------------------------------------------*/
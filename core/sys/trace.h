@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A binary trace of spans and events, kept in a ring buffer.
+ *
+ *         Each record holds a timestamp, the event number, the kind
+ *         of record (the start or the end of a span, or a single
+ *         event), and the process that was running. Spans may be
+ *         nested. The event numbers are assigned at compile time from
+ *         the list in sys/trace-events.h, so taking a trace record
+ *         costs a few stores and no string handling.
+ *
+ *         When the buffer is full, the oldest records are
+ *         overwritten, so the trace always holds the most recent
+ *         activity. The buffer is drained with trace_drain(), which
+ *         encodes the records in the format below, or printed on the
+ *         serial line with trace_print(). The host tool
+ *         tools/trace/trace-decode turns the result into folded
+ *         stacks for flame graphs and into latency histograms.
+ *
+ *         A drained chunk is one of:
+ *
+ *         - 'R', count, dropped (2 bytes), ticks per second (4 bytes),
+ *           timestamp bits (1 byte), and count records of 8 bytes:
+ *           timestamp (4 bytes), process (2 bytes), event (1 byte)
+ *           and kind (1 byte). Dropped is the number of records that
+ *           were overwritten before they could be drained.
+ *
+ *         - 'P', process (2 bytes), the length of the name (1 byte)
+ *           and the name of the process.
+ *
+ *         Several chunks may follow each other in one line or
+ *         datagram. All multi-byte fields are in network byte order.
+ *         A process is identified by the low 16 bits of the address
+ *         of its process structure.
+ *
+ *         Tracing is enabled with TRACE_CONF_ON. When it is off, the
+ *         trace macros expand to nothing.
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#include "contiki-conf.h"
+#include "sys/process.h"
+#include "sys/rtimer.h"
+
+#ifdef TRACE_CONF_ON
+#define TRACE_ON TRACE_CONF_ON
+#else /* TRACE_CONF_ON */
+#define TRACE_ON 0
+#endif /* TRACE_CONF_ON */
+
+/* The number of records in the ring buffer. Must be a power of two. */
+#ifdef TRACE_CONF_SIZE
+#define TRACE_SIZE TRACE_CONF_SIZE
+#else /* TRACE_CONF_SIZE */
+#define TRACE_SIZE 64
+#endif /* TRACE_CONF_SIZE */
+
+#if TRACE_SIZE & (TRACE_SIZE - 1)
+#error TRACE_CONF_SIZE must be a power of two
+#endif
+
+enum {
+#define TRACE_EVENT(name) TRACE_##name,
+#include "sys/trace-events.h"
+#undef TRACE_EVENT
+  TRACE_EVENT_NUM
+};
+
+#define TRACE_KIND_EVENT 0
+#define TRACE_KIND_BEGIN 1
+#define TRACE_KIND_END   2
+
+#define TRACE_CHUNK_RECORDS   'R'
+#define TRACE_CHUNK_PROCESS   'P'
+#define TRACE_CHUNK_HDR_LEN   9
+#define TRACE_RECORD_LEN      8
+
+struct trace_record {
+  rtimer_clock_t time;
+  uint16_t process;
+  uint8_t event;
+  uint8_t kind;
+};
+
+#if TRACE_ON
+/**
+ * Mark the start of a span.
+ *
+ * \param event The event, TRACE_ followed by a name from
+ *              sys/trace-events.h.
+ */
+#define TRACE_BEGIN(event) trace_record((event), TRACE_KIND_BEGIN)
+
+/**
+ * Mark the end of a span that was started with TRACE_BEGIN().
+ */
+#define TRACE_END(event)   trace_record((event), TRACE_KIND_END)
+
+/**
+ * Record a single event.
+ */
+#define TRACE_MARK(event) trace_record((event), TRACE_KIND_EVENT)
+#else /* TRACE_ON */
+#define TRACE_BEGIN(event)
+#define TRACE_END(event)
+#define TRACE_MARK(event)
+#endif /* TRACE_ON */
+
+void trace_record(uint8_t event, uint8_t kind);
+
+/**
+ * Encode the oldest records of the trace into a buffer and remove
+ * them from the trace.
+ *
+ * \param buf The buffer.
+ * \param len The length of the buffer.
+ * \return The length of the chunk, or 0 if there was nothing to drain.
+ */
+int trace_drain(uint8_t *buf, int len);
+
+/**
+ * Encode the name of a process into a buffer, so that the decoder can
+ * name the records of the process.
+ *
+ * \return The length of the chunk.
+ */
+int trace_describe_process(uint8_t *buf, int len, struct process *p);
+
+/**
+ * The number of records waiting to be drained.
+ */
+int trace_pending(void);
+
+/**
+ * Print the names of the running processes and drain the whole trace
+ * on the serial line, as lines of "trace " followed by the chunks in
+ * hexadecimal.
+ */
+void trace_print(void);
+
+#endif /* __TRACE_H__ */
@@ -1,3 +1,4 @@
 #include "symbols.h"
 const int symbols_nelts = 0;
 const struct symbols symbols[] = {{0,0}};
+const struct symbols_hash symbols_hash = {0, 0, 0, 0};
@@ -47,6 +47,7 @@
 #define REST_RES_HELLO 1
 #define REST_RES_MIRROR 0 /* causes largest code size */
 #define REST_RES_CHUNKS 1
+#define REST_RES_JSON 1
 #define REST_RES_SEPARATE 1
 #define REST_RES_PUSHING 1
 #define REST_RES_EVENT 1
@@ -66,6 +67,9 @@
 
 #include "erbium.h"
 
+#if REST_RES_JSON
+#include "jsontree.h"
+#endif
 
 #if defined (PLATFORM_HAS_BUTTON)
 #include "dev/button-sensor.h"
@@ -356,6 +360,52 @@ chunks_handler(void* request, void* response, uint8_t *buffer, uint16_t preferre
 }
 #endif
 
+/******************************************************************************/
+#if REST_RES_JSON
+/*
+ * Larger JSON documents can be generated from a jsontree. jsontree_print_block() follows the offset contract of
+ * chunk-wise resources and continues each block where the previous one stopped, so the tree is not walked from its
+ * start again for every block.
+ */
+RESOURCE(json, METHOD_GET, "test/json", "title=\"JSON blockwise demo\";ct=50");
+
+static struct jsontree_string json_title = JSONTREE_STRING("Erbium (Er) REST Engine example");
+static struct jsontree_string json_blockwise = JSONTREE_STRING("Served blockwise from a jsontree");
+static struct jsontree_int json_chunk_size = { JSON_TYPE_INT, REST_MAX_CHUNK_SIZE };
+static struct jsontree_string json_hello = JSONTREE_STRING("hello");
+static struct jsontree_string json_chunks = JSONTREE_STRING("test/chunks");
+static struct jsontree_string json_self = JSONTREE_STRING("test/json");
+static struct jsontree_value *json_resource_values[] = {
+  (struct jsontree_value *)&json_hello,
+  (struct jsontree_value *)&json_chunks,
+  (struct jsontree_value *)&json_self,
+};
+static struct jsontree_array json_resources = {
+  JSON_TYPE_ARRAY,
+  sizeof(json_resource_values) / sizeof(json_resource_values[0]),
+  json_resource_values
+};
+JSONTREE_OBJECT(json_tree,
+                JSONTREE_PAIR("title", &json_title),
+                JSONTREE_PAIR("description", &json_blockwise),
+                JSONTREE_PAIR("max-chunk-size", &json_chunk_size),
+                JSONTREE_PAIR("resources", &json_resources));
+
+static struct jsontree_context json_context;
+
+void
+json_handler(void* request, void* response, uint8_t *buffer, uint16_t preferred_size, int32_t *offset)
+{
+  int length;
+
+  /* The context is set up once, in the main process; any offset can be served from it. */
+  length = jsontree_print_block(&json_context, (char *)buffer, preferred_size, offset);
+
+  REST.set_header_content_type(response, REST.type.APPLICATION_JSON);
+  REST.set_response_payload(response, buffer, length);
+}
+#endif
+
 /******************************************************************************/
 #if REST_RES_SEPARATE && defined (PLATFORM_HAS_BUTTON) && WITH_COAP > 3
 /* Required to manually (=not by the engine) handle the response transaction. */
@@ -809,6 +859,10 @@ PROCESS_THREAD(rest_server_example, ev, data)
 #if REST_RES_CHUNKS
   rest_activate_resource(&resource_chunks);
 #endif
+#if REST_RES_JSON
+  jsontree_setup(&json_context, (struct jsontree_value *)&json_tree, NULL);
+  rest_activate_resource(&resource_json);
+#endif
 #if REST_RES_PUSHING
   rest_activate_periodic_resource(&periodic_resource_pushing);
 #endif
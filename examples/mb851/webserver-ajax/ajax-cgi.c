@@ -93,7 +93,7 @@ PT_THREAD(nodeidcall(struct httpd_state *s, char *ptr))
        rimeaddr_node_addr.u8[5],
        rimeaddr_node_addr.u8[6],
        rimeaddr_node_addr.u8[7]);
-  PSOCK_SEND_STR(&s->sout, buf);
+  HTTPD_CGI_SEND_STR(s, buf);
   PSOCK_END(&s->sout);
 }
 /*---------------------------------------------------------------------------*/
@@ -134,7 +134,7 @@ PT_THREAD(sensorscall(struct httpd_state *s, char *ptr))
     
   SENSORS_DEACTIVATE(acc_sensor);
 
-  PSOCK_SEND_STR(&s->sout, buf);
+  HTTPD_CGI_SEND_STR(s, buf);
 
 
   snprintf(buf, sizeof(buf),
@@ -148,7 +148,7 @@ PT_THREAD(sensorscall(struct httpd_state *s, char *ptr))
   last_lpm = energest_type_time(ENERGEST_TYPE_LPM);
   last_transmit = energest_type_time(ENERGEST_TYPE_TRANSMIT);
   last_listen = energest_type_time(ENERGEST_TYPE_LISTEN);
-  PSOCK_SEND_STR(&s->sout, buf);
+  HTTPD_CGI_SEND_STR(s, buf);
 
   PSOCK_END(&s->sout);
 }
@@ -228,7 +228,7 @@ PT_THREAD(neighborscall(struct httpd_state *s, char *ptr))
     /*    printf("count %d\n", s->u.count);*/
     if(collect_neighbor_get(s->u.count) != NULL) {
       /*      printf("!= NULL\n");*/
-      PSOCK_GENERATOR_SEND(&s->sout, make_neighbor, s);
+      HTTPD_CGI_GENERATOR_SEND(s, make_neighbor, s);
     }
   }
 
@@ -84,7 +84,7 @@ PT_THREAD(nodeidcall(struct httpd_state *s, char *ptr))
   PSOCK_BEGIN(&s->sout);
   snprintf(buf, sizeof(buf), "%d.%d",
 	   rimeaddr_node_addr.u8[0], rimeaddr_node_addr.u8[1]);
-  PSOCK_SEND_STR(&s->sout, buf);
+  HTTPD_CGI_SEND_STR(s, buf);
   PSOCK_END(&s->sout);
 }
 /*---------------------------------------------------------------------------*/
@@ -142,7 +142,7 @@ PT_THREAD(sensorscall(struct httpd_state *s, char *ptr))
 	     0,
 	     0);
 #endif /* CONTIKI_TARGET_SKY */
-    PSOCK_SEND_STR(&s->sout, buf);
+    HTTPD_CGI_SEND_STR(s, buf);
 
 
     /*    timer_restart(&t);
@@ -158,7 +158,7 @@ PT_THREAD(sensorscall(struct httpd_state *s, char *ptr))
     last_lpm = energest_type_time(ENERGEST_TYPE_LPM);
     last_transmit = energest_type_time(ENERGEST_TYPE_TRANSMIT);
     last_listen = energest_type_time(ENERGEST_TYPE_LISTEN);
-    PSOCK_SEND_STR(&s->sout, buf);
+    HTTPD_CGI_SEND_STR(s, buf);
 
 }
   PSOCK_END(&s->sout);
@@ -194,7 +194,7 @@ PT_THREAD(neighborscall(struct httpd_state *s, char *ptr))
     /*  printf("count %d\n", s->u.count); */
     if(collect_neighbor_list_get(&neighbor_list, s->u.count) != NULL) {
       /*  printf("!= NULL\n"); */
-      PSOCK_GENERATOR_SEND(&s->sout, make_neighbor, s);
+      HTTPD_CGI_GENERATOR_SEND(s, make_neighbor, s);
     }
   }
 
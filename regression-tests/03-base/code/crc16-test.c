@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         Cross-check of crc16_data() against the bit-serial CRC16,
+ *         and a micro-benchmark of the two.
+ */
+
+#include "contiki.h"
+#include "lib/crc16.h"
+#include "lib/random.h"
+#include "sys/rtimer.h"
+
+#include <stdio.h>
+
+#define BUFSIZE    128
+#define MAX_OFFSET 8
+#define ROUNDS     100
+
+static unsigned char buf[BUFSIZE + MAX_OFFSET];
+
+PROCESS(crc16_test_process, "CRC16 test");
+AUTOSTART_PROCESSES(&crc16_test_process);
+/*---------------------------------------------------------------------------*/
+/* The bit-serial CRC16 that crc16_add() uses without lookup tables. */
+static unsigned short
+reference_add(unsigned char b, unsigned short acc)
+{
+  acc ^= b;
+  acc  = (acc >> 8) | (acc << 8);
+  acc ^= (acc & 0xff00) << 4;
+  acc ^= (acc >> 8) >> 4;
+  acc ^= (acc & 0xff00) >> 5;
+  return acc;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+reference_data(const unsigned char *data, int len, unsigned short acc)
+{
+  while(len-- > 0) {
+    acc = reference_add(*data++, acc);
+  }
+  return acc;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(crc16_test_process, ev, data)
+{
+  static struct etimer et;
+  rtimer_clock_t start, reference_time, crc16_time;
+  unsigned short acc;
+  int i, len, offset, errors;
+
+  PROCESS_BEGIN();
+
+  etimer_set(&et, CLOCK_SECOND);
+  PROCESS_WAIT_UNTIL(etimer_expired(&et));
+
+  for(i = 0; i < sizeof(buf); i++) {
+    buf[i] = random_rand();
+  }
+
+  /* Every length and alignment, so that every path through the
+     sliced loop and the byte loop after it is taken. */
+  errors = 0;
+  for(len = 0; len <= BUFSIZE; len++) {
+    for(offset = 0; offset < MAX_OFFSET; offset++) {
+      acc = random_rand();
+      if(crc16_data(&buf[offset], len, acc) !=
+         reference_data(&buf[offset], len, acc)) {
+        printf("crc16 mismatch: length %d offset %d\n", len, offset);
+        errors++;
+      }
+      if(crc16_add(buf[offset], acc) != reference_add(buf[offset], acc)) {
+        printf("crc16_add mismatch: byte %d\n", buf[offset]);
+        errors++;
+      }
+    }
+  }
+  /* The check value of the CRC-16/KERMIT algorithm. */
+  if(crc16_data((const unsigned char *)"123456789", 9, 0) != 0x2189) {
+    printf("crc16 check value mismatch\n");
+    errors++;
+  }
+
+  start = RTIMER_NOW();
+  acc = 0;
+  for(i = 0; i < ROUNDS; i++) {
+    acc = reference_data(buf, BUFSIZE, acc);
+  }
+  reference_time = RTIMER_NOW() - start;
+
+  start = RTIMER_NOW();
+  acc = 0;
+  for(i = 0; i < ROUNDS; i++) {
+    acc = crc16_data(buf, BUFSIZE, acc);
+  }
+  crc16_time = RTIMER_NOW() - start;
+
+  printf("crc16 benchmark: %d x %d bytes, bit-serial %u ticks, crc16_data %u ticks\n",
+         ROUNDS, BUFSIZE, (unsigned)reference_time, (unsigned)crc16_time);
+
+  if(errors == 0) {
+    printf("crc16 ok\n");
+  } else {
+    printf("crc16 failed: %d errors\n", errors);
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
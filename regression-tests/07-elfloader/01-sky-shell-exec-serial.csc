@@ -178,6 +178,9 @@ while (true) {
   if (msg.contains("OK")) {
     log.log("&gt; ELF loader returned OK\n");
   }
+  if (msg.contains("loaded in")) {
+    log.log("&gt; ELF loader statistics: " + msg.substring(msg.indexOf("loaded in")) + "\n");
+  }
   if (msg.contains("Hello, world")) {
     log.log("&gt; Hello world process started\n");
     log.testOK();
@@ -64,6 +64,11 @@ receiver(struct simple_udp_connection *c,
   uip_debug_ipaddr_print(sender_addr);
   printf(" on port %d from port %d with length %d: '%s'\n",
          receiver_port, sender_port, datalen, data);
+#ifdef RECEIVER_CONF_ECHO
+  /* Send the message back, so that the route down to the sender is
+     tested too. */
+  simple_udp_sendto(c, data, datalen, sender_addr);
+#endif /* RECEIVER_CONF_ECHO */
 }
 /*---------------------------------------------------------------------------*/
 static uip_ipaddr_t *
@@ -90,6 +95,14 @@ set_global_address(void)
   return &ipaddr;
 }
 /*---------------------------------------------------------------------------*/
+#ifdef RPL_DEBUG_DAO_OUTPUT
+void
+RPL_DEBUG_DAO_OUTPUT(rpl_parent_t *parent)
+{
+  printf("DAO sent\n");
+}
+#endif /* RPL_DEBUG_DAO_OUTPUT */
+/*---------------------------------------------------------------------------*/
 uint8_t should_blink = 1;
 static void
 route_callback(int event, uip_ipaddr_t *route, uip_ipaddr_t *ipaddr)
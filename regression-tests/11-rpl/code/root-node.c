@@ -114,8 +114,27 @@ create_rpl_dag(uip_ipaddr_t *ipaddr)
   }
 }
 /*---------------------------------------------------------------------------*/
+#ifdef RPL_DEBUG_DAO_OUTPUT
+void
+RPL_DEBUG_DAO_OUTPUT(rpl_parent_t *parent)
+{
+  printf("DAO sent\n");
+}
+#endif /* RPL_DEBUG_DAO_OUTPUT */
+/*---------------------------------------------------------------------------*/
+static void
+route_callback(int event, uip_ipaddr_t *route, uip_ipaddr_t *ipaddr,
+               int num_routes)
+{
+  if(event == UIP_DS6_NOTIFICATION_ROUTE_ADD ||
+     event == UIP_DS6_NOTIFICATION_ROUTE_RM) {
+    printf("Routes %d\n", num_routes);
+  }
+}
+/*---------------------------------------------------------------------------*/
 PROCESS_THREAD(unicast_receiver_process, ev, data)
 {
+  static struct uip_ds6_notification n;
   uip_ipaddr_t *ipaddr;
 
   PROCESS_BEGIN();
@@ -124,6 +143,8 @@ PROCESS_THREAD(unicast_receiver_process, ev, data)
 
   create_rpl_dag(ipaddr);
 
+  uip_ds6_notification_add(&n, route_callback);
+
   simple_udp_register(&unicast_connection, UDP_PORT,
                       NULL, UDP_PORT, receiver);
 
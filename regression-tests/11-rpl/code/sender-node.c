@@ -38,12 +38,18 @@
 
 #include "simple-udp.h"
 
+#include "net/rpl/rpl.h"
+
 #include <stdio.h>
 #include <string.h>
 
 #define UDP_PORT 1234
 
+#ifdef SENDER_CONF_SEND_INTERVAL
+#define SEND_INTERVAL		SENDER_CONF_SEND_INTERVAL
+#else
 #define SEND_INTERVAL		(60 * CLOCK_SECOND)
+#endif
 #define SEND_TIME		(random_rand() % (SEND_INTERVAL))
 
 static struct simple_udp_connection unicast_connection;
@@ -65,6 +71,14 @@ receiver(struct simple_udp_connection *c,
          receiver_port, sender_port, datalen);
 }
 /*---------------------------------------------------------------------------*/
+#ifdef RPL_DEBUG_DAO_OUTPUT
+void
+RPL_DEBUG_DAO_OUTPUT(rpl_parent_t *parent)
+{
+  printf("DAO sent\n");
+}
+#endif /* RPL_DEBUG_DAO_OUTPUT */
+/*---------------------------------------------------------------------------*/
 static void
 set_global_address(void)
 {
@@ -0,0 +1,1066 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A benchmark suite of hot paths in core/lib, core/sys and
+ *         core/net. The results are printed as CSV, or as JSON when
+ *         the program is built with BENCHMARK_PRINT_FUNCTION set to
+ *         benchmark_print_json.
+ */
+
+#include "contiki.h"
+#include "lib/list.h"
+#include "lib/memb.h"
+#include "lib/crc16.h"
+#include "sys/ctimer.h"
+#include "sys/trace.h"
+#include "dev/cc2420.h"
+#include "net/packetbuf.h"
+#include "net/netstack.h"
+#include "net/tcpip.h"
+#include "net/uip-ds6.h"
+#include "net/rime/rimestats.h"
+#include "net/rime/chameleon.h"
+#include "net/rime/chameleon-bitopt.h"
+#include "net/rime/collect.h"
+#include "net/mac/frame802154.h"
+#include "net/mac/phase.h"
+#include "jsonparse.h"
+#include "jsonstream.h"
+#include "jsontree.h"
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NUM_ITEMS 16
+
+#define UIP_IP_BUF ((struct uip_ip_hdr *)&uip_buf[UIP_LLH_LEN])
+
+struct item {
+  struct item *next;
+  unsigned value;
+};
+
+LIST(items);
+MEMB(items_memb, struct item, NUM_ITEMS);
+static struct item item_array[NUM_ITEMS];
+static struct item *item_ptrs[NUM_ITEMS];
+
+static struct etimer etimers[NUM_ITEMS];
+static struct ctimer ctimers[NUM_ITEMS];
+
+static unsigned char crc_buf[128];
+
+static uint8_t frame[127];
+static uint8_t frame_len;
+
+static uip_ipaddr_t last_route;
+static uip_lladdr_t dest_lladdr;
+static uint16_t compressed_len;
+
+/* jsonparse does not handle negative numbers or literals, so the
+   document has none. */
+static const char json_doc[] =
+  "{\"node\":\"aaaa::212:7401:1:101\",\"uptime\":123456,"
+  "\"config\":{\"interval\":60,\"power\":5,\"enabled\":1},"
+  "\"readings\":[{\"sensor\":\"temperature\",\"value\":21.5},"
+  "{\"sensor\":\"humidity\",\"value\":43},"
+  "{\"sensor\":\"light\",\"value\":312}],\"comment\":\"\"}";
+/* The number of tokens in json_doc, counting each container twice. */
+#define JSON_DOC_TOKENS 38
+static int json_tokens;
+
+/* Checked after each run; a benchmark that computes the wrong
+   result is reported as a failure. */
+static int failures;
+
+PROCESS(benchmark_process, "Benchmarks");
+AUTOSTART_PROCESSES(&benchmark_process);
+/*---------------------------------------------------------------------------*/
+/* A MAC driver that only records the length of the compressed packet,
+   so that the 6lowpan benchmark measures 6lowpan alone. */
+static void
+send_packet(mac_callback_t sent, void *ptr)
+{
+  compressed_len = packetbuf_totlen();
+}
+/*---------------------------------------------------------------------------*/
+static void
+input_packet(void)
+{
+}
+/*---------------------------------------------------------------------------*/
+static int
+on(void)
+{
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static int
+off(int keep_radio_on)
+{
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned short
+channel_check_interval(void)
+{
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+init(void)
+{
+}
+/*---------------------------------------------------------------------------*/
+const struct mac_driver benchmark_mac_driver = {
+  "benchmark",
+  init,
+  send_packet,
+  input_packet,
+  on,
+  off,
+  channel_check_interval,
+};
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(list_add_remove, "list_add() and list_remove()", NUM_ITEMS);
+BENCHMARK(list_add_remove)
+{
+  unsigned i;
+
+  list_init(items);
+
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    list_add(items, &item_array[i]);
+  }
+  /* Remove from the tail, the slowest case of a singly linked list. */
+  BENCHMARK_LOOP(i) {
+    list_remove(items, &item_array[NUM_ITEMS - 1 - i]);
+  }
+  BENCHMARK_END();
+
+  if(list_head(items) != NULL) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(memb_alloc_free, "memb_alloc() and memb_free()", NUM_ITEMS);
+BENCHMARK(memb_alloc_free)
+{
+  unsigned i;
+
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    item_ptrs[i] = memb_alloc(&items_memb);
+  }
+  BENCHMARK_LOOP(i) {
+    memb_free(&items_memb, item_ptrs[NUM_ITEMS - 1 - i]);
+  }
+  BENCHMARK_END();
+
+  if(item_ptrs[NUM_ITEMS - 1] == NULL) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(crc16_data, "crc16_data() over 128 bytes", NUM_ITEMS);
+BENCHMARK(crc16_data)
+{
+  unsigned i;
+  unsigned short crc;
+
+  crc = 0;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    crc = crc16_data(crc_buf, sizeof(crc_buf), crc);
+  }
+  BENCHMARK_END();
+
+  /* Keep the compiler from dropping the loop. */
+  crc_buf[0] = crc & 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+ctimer_callback(void *ptr)
+{
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(etimer_set_stop, "etimer_set() and etimer_stop()", NUM_ITEMS);
+BENCHMARK(etimer_set_stop)
+{
+  unsigned i;
+
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    etimer_set(&etimers[i], CLOCK_SECOND + i);
+  }
+  BENCHMARK_LOOP(i) {
+    etimer_stop(&etimers[i]);
+  }
+  BENCHMARK_END();
+
+  if(!etimer_expired(&etimers[NUM_ITEMS - 1])) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(ctimer_set_stop, "ctimer_set() and ctimer_stop()", NUM_ITEMS);
+BENCHMARK(ctimer_set_stop)
+{
+  unsigned i;
+
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    ctimer_set(&ctimers[i], CLOCK_SECOND + i, ctimer_callback, NULL);
+  }
+  BENCHMARK_LOOP(i) {
+    ctimer_stop(&ctimers[i]);
+  }
+  BENCHMARK_END();
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(trace_record, "trace_record() of a span", NUM_ITEMS);
+BENCHMARK(trace_record)
+{
+  unsigned i;
+
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    trace_record(TRACE_process_call, TRACE_KIND_BEGIN);
+    trace_record(TRACE_process_call, TRACE_KIND_END);
+  }
+  BENCHMARK_END();
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(frame802154_parse, "frame802154_parse()", NUM_ITEMS);
+BENCHMARK(frame802154_parse)
+{
+  unsigned i;
+  frame802154_t pf;
+  uint8_t hdrlen;
+
+  hdrlen = 0;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    hdrlen = frame802154_parse(frame, frame_len, &pf);
+  }
+  BENCHMARK_END();
+
+  if(hdrlen == 0 || pf.fcf.frame_type != FRAME802154_DATAFRAME) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(route_lookup, "uip_ds6_route_lookup() of the last route",
+                   NUM_ITEMS);
+BENCHMARK(route_lookup)
+{
+  unsigned i;
+  uip_ds6_route_t *r;
+
+  r = NULL;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    r = uip_ds6_route_lookup(&last_route);
+  }
+  BENCHMARK_END();
+
+  if(r == NULL) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(sicslowpan_compress,
+                   "6lowpan compression of a link-local UDP packet", 1);
+BENCHMARK(sicslowpan_compress)
+{
+  struct uip_udp_hdr *udp;
+  unsigned i;
+
+  /* 6lowpan compresses the packet in uip_buf, so it has to be rebuilt
+     before each run. */
+  memset(UIP_IP_BUF, 0, UIP_IPUDPH_LEN);
+  UIP_IP_BUF->vtc = 0x60;
+  UIP_IP_BUF->len[1] = UIP_UDPH_LEN + 32;
+  UIP_IP_BUF->proto = UIP_PROTO_UDP;
+  UIP_IP_BUF->ttl = 64;
+  uip_create_linklocal_prefix(&UIP_IP_BUF->srcipaddr);
+  uip_ds6_set_addr_iid(&UIP_IP_BUF->srcipaddr, &uip_lladdr);
+  uip_create_linklocal_prefix(&UIP_IP_BUF->destipaddr);
+  uip_ds6_set_addr_iid(&UIP_IP_BUF->destipaddr, &dest_lladdr);
+  udp = (struct uip_udp_hdr *)&uip_buf[UIP_LLH_LEN + UIP_IPH_LEN];
+  udp->srcport = UIP_HTONS(0xf0b1);
+  udp->destport = UIP_HTONS(0xf0b2);
+  udp->udplen = UIP_HTONS(UIP_UDPH_LEN + 32);
+  for(i = 0; i < 32; i++) {
+    uip_buf[UIP_LLH_LEN + UIP_IPUDPH_LEN + i] = i;
+  }
+  uip_len = UIP_IPUDPH_LEN + 32;
+  compressed_len = 0;
+
+  BENCHMARK_BEGIN();
+  tcpip_output(&dest_lladdr);
+  BENCHMARK_END();
+
+  if(compressed_len == 0 || compressed_len >= UIP_IPUDPH_LEN + 32) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(jsonparse_document, "jsonparse_next() over a document", 1);
+BENCHMARK(jsonparse_document)
+{
+  struct jsonparse_state js;
+  int tokens;
+
+  tokens = 0;
+  BENCHMARK_BEGIN();
+  jsonparse_setup(&js, json_doc, sizeof(json_doc) - 1);
+  while(jsonparse_next(&js) != 0) {
+    tokens++;
+  }
+  BENCHMARK_END();
+
+  if(js.pos < sizeof(json_doc) - 1 || js.error != JSON_ERROR_OK) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+count_tokens(struct jsonstream_state *state, char type, const char *value,
+             int len)
+{
+  if(!jsonstream_more(state)) {
+    json_tokens++;
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(jsonstream_document,
+                   "jsonstream_feed() of a document", 1);
+BENCHMARK(jsonstream_document)
+{
+  struct jsonstream_state js;
+  int r;
+
+  json_tokens = 0;
+  BENCHMARK_BEGIN();
+  jsonstream_init(&js, count_tokens, NULL);
+  r = jsonstream_feed(&js, json_doc, sizeof(json_doc) - 1);
+  r |= jsonstream_finish(&js);
+  BENCHMARK_END();
+
+  if(json_tokens != JSON_DOC_TOKENS || r != JSON_ERROR_OK) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(jsonstream_chunks,
+                   "jsonstream_feed() of a document in 16 byte chunks", 1);
+BENCHMARK(jsonstream_chunks)
+{
+  struct jsonstream_state js;
+  int r, pos, len;
+
+  json_tokens = 0;
+  r = JSON_ERROR_OK;
+  BENCHMARK_BEGIN();
+  jsonstream_init(&js, count_tokens, NULL);
+  for(pos = 0; pos < sizeof(json_doc) - 1; pos += len) {
+    len = sizeof(json_doc) - 1 - pos;
+    if(len > 16) {
+      len = 16;
+    }
+    r |= jsonstream_feed(&js, &json_doc[pos], len);
+  }
+  r |= jsonstream_finish(&js);
+  BENCHMARK_END();
+
+  if(json_tokens != JSON_DOC_TOKENS || r != JSON_ERROR_OK) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Every token of the document is split between chunks at some chunk
+   size, so the values are extracted from the joined fragments. */
+#define JSON_MAX_CHUNK 8
+BENCHMARK_REGISTER(jsonstream_extract,
+                   "jsonstream_feed() extracting values from small chunks",
+                   JSON_MAX_CHUNK);
+BENCHMARK(jsonstream_extract)
+{
+  struct jsonstream_state js;
+  char interval[8];
+  char sensor[12];
+  char value[8];
+  struct jsonstream_field fields[] = {
+    { "config.interval", NULL, sizeof(interval) },
+    { "readings.1.sensor", NULL, sizeof(sensor) },
+    { "readings.2.value", NULL, sizeof(value) },
+  };
+  unsigned i;
+  int r, pos, len, ok;
+
+  fields[0].buf = interval;
+  fields[1].buf = sensor;
+  fields[2].buf = value;
+  ok = 1;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    interval[0] = sensor[0] = value[0] = '\0';
+    r = JSON_ERROR_OK;
+    jsonstream_init(&js, NULL, NULL);
+    jsonstream_extract(&js, fields, 3);
+    for(pos = 0; pos < sizeof(json_doc) - 1; pos += len) {
+      len = sizeof(json_doc) - 1 - pos;
+      if(len > i + 1) {
+        len = i + 1;
+      }
+      r |= jsonstream_feed(&js, &json_doc[pos], len);
+    }
+    r |= jsonstream_finish(&js);
+    ok &= r == JSON_ERROR_OK && strcmp(interval, "60") == 0 &&
+      strcmp(sensor, "humidity") == 0 && strcmp(value, "312") == 0;
+  }
+  BENCHMARK_END();
+
+  if(!ok) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static struct jsontree_string json_text =
+  JSONTREE_STRING("a string value of a JSON tree that is served blockwise");
+static struct jsontree_value *json_values[] = {
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+  (struct jsontree_value *)&json_text, (struct jsontree_value *)&json_text,
+};
+static struct jsontree_array json_tree = {
+  JSON_TYPE_ARRAY, sizeof(json_values) / sizeof(json_values[0]), json_values
+};
+/* The offset of the last 64 byte block of the tree. */
+#define JSON_BLOCK_SIZE 64
+#define JSON_LAST_BLOCK (14 * JSON_BLOCK_SIZE)
+static char json_block[JSON_BLOCK_SIZE];
+static int json_pos;
+/*---------------------------------------------------------------------------*/
+static int
+json_block_putchar(int c)
+{
+  if(json_pos >= JSON_LAST_BLOCK &&
+     json_pos < JSON_LAST_BLOCK + JSON_BLOCK_SIZE) {
+    json_block[json_pos - JSON_LAST_BLOCK] = c;
+  }
+  json_pos++;
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(jsontree_rewalk_block,
+                   "jsontree_print_next() to the last block of a tree", 1);
+BENCHMARK(jsontree_rewalk_block)
+{
+  struct jsontree_context js;
+
+  json_pos = 0;
+  BENCHMARK_BEGIN();
+  jsontree_setup(&js, (struct jsontree_value *)&json_tree,
+                 json_block_putchar);
+  while(jsontree_print_next(&js) &&
+        json_pos < JSON_LAST_BLOCK + JSON_BLOCK_SIZE);
+  BENCHMARK_END();
+
+  if(json_pos < JSON_LAST_BLOCK) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(jsontree_print_block,
+                   "jsontree_print_block() of the last block of a tree", 1);
+BENCHMARK(jsontree_print_block)
+{
+  struct jsontree_context js;
+  int32_t offset;
+  int len;
+
+  jsontree_setup(&js, (struct jsontree_value *)&json_tree, NULL);
+  for(offset = 0; offset < JSON_LAST_BLOCK;) {
+    jsontree_print_block(&js, json_block, JSON_BLOCK_SIZE, &offset);
+  }
+
+  BENCHMARK_BEGIN();
+  len = jsontree_print_block(&js, json_block, JSON_BLOCK_SIZE, &offset);
+  BENCHMARK_END();
+
+  if(len == 0) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* The header of a collect packet: three addresses and six small
+   attributes. chameleon-bitopt copies the attributes a byte at a
+   time; it is measured against a version that streams them through a
+   16-bit accumulator. Both must produce the same header. */
+static const struct packetbuf_attrlist collect_attrs[] = {
+  COLLECT_ATTRIBUTES
+  PACKETBUF_ATTR_LAST
+};
+static struct channel collect_channel;
+static uint8_t collect_hdr[PACKETBUF_HDR_SIZE];
+static uint8_t collect_hdrlen;
+
+struct bitstream {
+  uint8_t *ptr;
+  uint16_t acc;
+  uint8_t nbits;
+};
+
+static void
+collect_set_attrs(void)
+{
+  rimeaddr_t addr;
+  int i;
+
+  packetbuf_clear();
+  for(i = 0; i < sizeof(addr.u8); i++) {
+    addr.u8[i] = 0x10 + i;
+  }
+  packetbuf_set_addr(PACKETBUF_ADDR_ESENDER, &addr);
+  addr.u8[0] = 0x20;
+  packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &addr);
+  addr.u8[0] = 0x30;
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &addr);
+  packetbuf_set_attr(PACKETBUF_ATTR_EPACKET_ID, 0xa5);
+  packetbuf_set_attr(PACKETBUF_ATTR_PACKET_ID, 0x3c);
+  packetbuf_set_attr(PACKETBUF_ATTR_TTL, 9);
+  packetbuf_set_attr(PACKETBUF_ATTR_HOPS, 5);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAX_REXMIT, 17);
+  packetbuf_set_attr(PACKETBUF_ATTR_PACKET_TYPE, 1);
+}
+/*---------------------------------------------------------------------------*/
+static int
+collect_check_attrs(void)
+{
+  return packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[0] == 0x10 &&
+    packetbuf_addr(PACKETBUF_ADDR_ESENDER)->u8[1] == 0x11 &&
+    packetbuf_addr(PACKETBUF_ADDR_RECEIVER)->u8[0] == 0x20 &&
+    packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[0] == 0x30 &&
+    packetbuf_addr(PACKETBUF_ADDR_SENDER)->u8[1] == 0x11 &&
+    packetbuf_attr(PACKETBUF_ATTR_EPACKET_ID) == 0xa5 &&
+    packetbuf_attr(PACKETBUF_ATTR_PACKET_ID) == 0x3c &&
+    packetbuf_attr(PACKETBUF_ATTR_TTL) == 9 &&
+    packetbuf_attr(PACKETBUF_ATTR_HOPS) == 5 &&
+    packetbuf_attr(PACKETBUF_ATTR_MAX_REXMIT) == 17 &&
+    packetbuf_attr(PACKETBUF_ATTR_PACKET_TYPE) == 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+put_field(struct bitstream *s, const uint8_t *from, uint16_t len)
+{
+  uint8_t n;
+
+  if(s->nbits == 0) {
+    for(; len >= 8; len -= 8) {
+      *s->ptr++ = *from++;
+    }
+  }
+  while(len > 0) {
+    n = len < 8 ? len : 8;
+    s->acc = (s->acc << n) | (*from++ & (0xff >> (8 - n)));
+    s->nbits += n;
+    if(s->nbits >= 8) {
+      s->nbits -= 8;
+      *s->ptr++ = s->acc >> s->nbits;
+    }
+    len -= n;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+get_field(struct bitstream *s, uint8_t *to, uint16_t len)
+{
+  uint8_t n;
+
+  if(s->nbits == 0) {
+    for(; len >= 8; len -= 8) {
+      *to++ = *s->ptr++;
+    }
+  }
+  while(len > 0) {
+    n = len < 8 ? len : 8;
+    if(s->nbits < n) {
+      s->acc = (s->acc << 8) | *s->ptr++;
+      s->nbits += 8;
+    }
+    s->nbits -= n;
+    *to++ = (s->acc >> s->nbits) & (0xff >> (8 - n));
+    len -= n;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+stream_pack(struct channel *c)
+{
+  const struct packetbuf_attrlist *a;
+  struct bitstream s;
+  packetbuf_attr_t val;
+  uint8_t *hdrptr;
+
+  if(packetbuf_hdralloc((c->hdrsize + 7) / 8 + 2) == 0) {
+    return 0;
+  }
+  hdrptr = packetbuf_hdrptr();
+  hdrptr[0] = c->channelno & 0xff;
+  hdrptr[1] = (c->channelno >> 8) & 0xff;
+
+  s.ptr = hdrptr + 2;
+  s.acc = 0;
+  s.nbits = 0;
+  for(a = c->attrlist; a->type != PACKETBUF_ATTR_NONE; ++a) {
+    if(PACKETBUF_IS_ADDR(a->type)) {
+      put_field(&s, (const uint8_t *)packetbuf_addr(a->type), a->len);
+    } else {
+      val = packetbuf_attr(a->type);
+      put_field(&s, (const uint8_t *)&val, a->len);
+    }
+  }
+  if(s.nbits > 0) {
+    *s.ptr = s.acc << (8 - s.nbits);
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static int
+stream_unpack(struct channel *c)
+{
+  const struct packetbuf_attrlist *a;
+  struct bitstream s;
+  packetbuf_attr_t val;
+  rimeaddr_t addr;
+
+  if(packetbuf_hdrreduce(2) == 0) {
+    return 0;
+  }
+  s.ptr = packetbuf_dataptr();
+  s.acc = 0;
+  s.nbits = 0;
+  if(packetbuf_hdrreduce((c->hdrsize + 7) / 8) == 0) {
+    return 0;
+  }
+  for(a = c->attrlist; a->type != PACKETBUF_ATTR_NONE; ++a) {
+    if(PACKETBUF_IS_ADDR(a->type)) {
+      get_field(&s, (uint8_t *)&addr, a->len);
+      packetbuf_set_addr(a->type, &addr);
+    } else {
+      val = 0;
+      get_field(&s, (uint8_t *)&val, a->len);
+      packetbuf_set_attr(a->type, val);
+    }
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(chameleon_bitopt_pack,
+                   "chameleon-bitopt header of a collect packet", NUM_ITEMS);
+BENCHMARK(chameleon_bitopt_pack)
+{
+  unsigned i;
+  int ok;
+
+  ok = 1;
+  collect_set_attrs();
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    packetbuf_clear_hdr();
+    ok &= chameleon_bitopt.output(&collect_channel);
+  }
+  BENCHMARK_END();
+
+  collect_hdrlen = packetbuf_hdrlen();
+  memcpy(collect_hdr, packetbuf_hdrptr(), collect_hdrlen);
+  if(!ok || collect_hdrlen != (collect_channel.hdrsize + 7) / 8 + 2) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(chameleon_stream_pack,
+                   "collect header through a 16-bit accumulator", NUM_ITEMS);
+BENCHMARK(chameleon_stream_pack)
+{
+  unsigned i;
+  int ok;
+
+  ok = 1;
+  collect_set_attrs();
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    packetbuf_clear_hdr();
+    ok &= stream_pack(&collect_channel);
+  }
+  BENCHMARK_END();
+
+  if(!ok || packetbuf_hdrlen() != collect_hdrlen ||
+     memcmp(packetbuf_hdrptr(), collect_hdr, collect_hdrlen) != 0) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(chameleon_bitopt_unpack,
+                   "chameleon-bitopt input of a collect header", NUM_ITEMS);
+BENCHMARK(chameleon_bitopt_unpack)
+{
+  unsigned i;
+  int ok;
+
+  ok = 1;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    packetbuf_copyfrom(collect_hdr, collect_hdrlen);
+    ok &= chameleon_bitopt.input() == &collect_channel;
+  }
+  BENCHMARK_END();
+
+  if(!ok || !collect_check_attrs()) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+BENCHMARK_REGISTER(chameleon_stream_unpack,
+                   "collect header input through a 16-bit accumulator",
+                   NUM_ITEMS);
+BENCHMARK(chameleon_stream_unpack)
+{
+  unsigned i;
+  int ok;
+
+  ok = 1;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    packetbuf_copyfrom(collect_hdr, collect_hdrlen);
+    ok &= stream_unpack(&collect_channel);
+  }
+  BENCHMARK_END();
+
+  if(!ok || !collect_check_attrs()) {
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* The CC2420 driver reads frames from the simulated radio in
+   cc2420-sim.c through an RX ring of RX_RING_SIZE frames. Every frame
+   is filled with its sequence number, so that frames that are lost,
+   reordered or mixed up can be told. */
+#define RX_RING_SIZE 4
+#define RX_LEN(seqno) (5 + ((seqno) & 15))
+
+extern int cc2420_sim_selected;
+void cc2420_sim_receive(uint8_t tag, int len, int crc_ok);
+int cc2420_sim_fifo_len(void);
+
+static uint8_t rx_buf[127];
+static uint8_t rx_sent, rx_read;
+
+static void
+rx_receive(void)
+{
+  cc2420_sim_receive(rx_sent, RX_LEN(rx_sent), 1);
+  rx_sent++;
+}
+/*---------------------------------------------------------------------------*/
+static int
+rx_read_next(void)
+{
+  int len;
+
+  len = cc2420_driver.read(rx_buf, sizeof(rx_buf));
+  if(len != RX_LEN(rx_read) || rx_buf[0] != rx_read ||
+     rx_buf[len - 1] != rx_read) {
+    return 0;
+  }
+  rx_read++;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/* The ring indices and the sequence numbers wrap around many times
+   over the runs. */
+BENCHMARK_REGISTER(cc2420_rx_ring, "cc2420 frames through the RX ring",
+                   NUM_ITEMS);
+BENCHMARK(cc2420_rx_ring)
+{
+  unsigned i;
+  int ok;
+
+  ok = 1;
+  BENCHMARK_BEGIN();
+  BENCHMARK_LOOP(i) {
+    rx_receive();
+    if(i % RX_RING_SIZE == RX_RING_SIZE - 1) {
+      while(rx_read != rx_sent && rx_read_next());
+      ok &= rx_read == rx_sent;
+    }
+  }
+  BENCHMARK_END();
+
+  if(!ok) {
+    failures++;
+    rx_read = rx_sent;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+check_rx_ring(void)
+{
+  unsigned long count;
+  int i;
+
+  /* Frames that do not fit in the ring stay in the RX FIFO until
+     read() has made room for them. */
+  count = rimestats.rxringfull;
+  for(i = 0; i < RX_RING_SIZE + 2; i++) {
+    rx_receive();
+  }
+  if(rimestats.rxringfull == count || cc2420_sim_fifo_len() == 0) {
+    printf("cc2420 did not leave the frames in the FIFO\n");
+    failures++;
+  }
+  while(rx_read != rx_sent && rx_read_next());
+  if(rx_read != rx_sent || cc2420_sim_fifo_len() != 0) {
+    printf("cc2420 lost frames with a full ring\n");
+    failures++;
+    rx_read = rx_sent;
+  }
+
+  /* A frame that arrives during another SPI transaction is left in
+     the FIFO by the interrupt. */
+  cc2420_sim_selected = 1;
+  rx_receive();
+  cc2420_sim_selected = 0;
+  if(cc2420_sim_fifo_len() == 0 || !rx_read_next()) {
+    printf("cc2420 lost a frame during an SPI transaction\n");
+    failures++;
+    rx_read = rx_sent;
+  }
+
+  /* An RX FIFO overflow flushes the FIFO, but keeps the frames that
+     are in the ring. */
+  count = rimestats.rxoverflow;
+  for(i = 0; i < 128 && rimestats.rxoverflow == count; i++) {
+    rx_receive();
+  }
+  for(i = 0; i < RX_RING_SIZE && rx_read_next(); i++);
+  if(rimestats.rxoverflow == count || i < RX_RING_SIZE ||
+     cc2420_driver.read(rx_buf, sizeof(rx_buf)) != 0) {
+    printf("cc2420 did not recover from an RX FIFO overflow\n");
+    failures++;
+  }
+  rx_read = rx_sent;
+}
+/*---------------------------------------------------------------------------*/
+/* A neighbor whose clock runs fast, so that it wakes up PHASE_EARLY
+   ticks early every cycle. A transmission to it must be timed with
+   the negative skew correction, not just after the nominal cycle. */
+#define PHASE_CYCLE 1000
+#define PHASE_EARLY 100
+#define PHASE_GUARD 40
+
+PHASE_LIST(skew_phases, 1);
+static rimeaddr_t skew_neighbor;
+static rtimer_clock_t skew_expected;
+static rtimer_clock_t skew_sent;
+static int skew_done;
+static struct etimer skew_timer;
+
+static void
+skew_callback(void *ptr, int status, int num_tx)
+{
+  skew_sent = RTIMER_NOW();
+  skew_done = 1;
+  process_poll(&benchmark_process);
+}
+/*---------------------------------------------------------------------------*/
+static void
+phase_skew_start(void)
+{
+  rtimer_clock_t latest;
+  int i;
+
+  phase_init(&skew_phases);
+  skew_neighbor.u8[0] = 1;
+
+  /* The latest of three wake-ups was half a cycle ago. */
+  latest = RTIMER_NOW() - PHASE_CYCLE / 2;
+  for(i = 2; i >= 0; i--) {
+    phase_update(&skew_phases, &skew_neighbor,
+                 latest - i * (PHASE_CYCLE - PHASE_EARLY), PHASE_CYCLE,
+                 MAC_TX_OK);
+  }
+
+  /* The wake-ups were perfectly predicted, so only a quarter of the
+     guard time is used. */
+  skew_expected = latest + PHASE_CYCLE - PHASE_EARLY - PHASE_GUARD / 4;
+  skew_done = 0;
+  if(phase_wait(&skew_phases, &skew_neighbor, PHASE_CYCLE, PHASE_GUARD,
+                skew_callback, NULL, NULL) != PHASE_DEFERRED) {
+    printf("phase_wait() did not defer the packet\n");
+    failures++;
+    skew_done = 1;
+    return;
+  }
+  etimer_set(&skew_timer, CLOCK_SECOND * 2);
+}
+/*---------------------------------------------------------------------------*/
+static void
+phase_skew_check(void)
+{
+  rtimer_clock_t diff;
+
+  etimer_stop(&skew_timer);
+  if(!skew_done) {
+    printf("phase_wait() did not send the packet\n");
+    failures++;
+    return;
+  }
+  diff = RTIMER_CLOCK_LT(skew_sent, skew_expected) ?
+    skew_expected - skew_sent : skew_sent - skew_expected;
+  if(diff > PHASE_EARLY / 2) {
+    printf("phase_wait() sent %u ticks off the expected wake-up\n",
+           (unsigned)diff);
+    failures++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+setup(void)
+{
+  frame802154_t p;
+  uint8_t payload[32];
+  uip_ipaddr_t nexthop;
+  int i;
+
+  for(i = 0; i < sizeof(crc_buf); i++) {
+    crc_buf[i] = i * 7;
+  }
+
+  memset(&p, 0, sizeof(p));
+  memset(payload, 0, sizeof(payload));
+  p.fcf.frame_type = FRAME802154_DATAFRAME;
+  p.fcf.panid_compression = 1;
+  p.fcf.dest_addr_mode = FRAME802154_LONGADDRMODE;
+  p.fcf.src_addr_mode = FRAME802154_LONGADDRMODE;
+  p.fcf.frame_version = FRAME802154_IEEE802154_2003;
+  p.seq = 1;
+  p.dest_pid = 0xabcd;
+  p.src_pid = 0xabcd;
+  for(i = 0; i < 8; i++) {
+    p.dest_addr[i] = i + 1;
+    p.src_addr[i] = i + 9;
+  }
+  p.payload = payload;
+  p.payload_len = sizeof(payload);
+  frame_len = frame802154_create(&p, frame, sizeof(frame));
+
+  /* Fill the routing table, so that looking up the last route walks
+     the whole list. */
+  uip_ip6addr(&nexthop, 0xfe80, 0, 0, 0, 0, 0, 0, 1);
+  for(i = 0; i < UIP_DS6_ROUTE_NB; i++) {
+    uip_ip6addr(&last_route, 0xaaaa, 0, 0, 0, 0, 0, 0, i + 2);
+    if(uip_ds6_route_add(&last_route, 128, &nexthop, 0) == NULL) {
+      failures++;
+    }
+  }
+
+  for(i = 0; i < sizeof(dest_lladdr.addr); i++) {
+    dest_lladdr.addr[i] = 0x20 + i;
+  }
+
+  cc2420_init();
+
+  chameleon_init();
+  channel_open(&collect_channel, 130);
+  channel_set_attributes(130, collect_attrs);
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(benchmark_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  setup();
+
+  BENCHMARK_RUN(list_add_remove);
+  BENCHMARK_RUN(memb_alloc_free);
+  BENCHMARK_RUN(crc16_data);
+  BENCHMARK_RUN(etimer_set_stop);
+  BENCHMARK_RUN(ctimer_set_stop);
+  BENCHMARK_RUN(trace_record);
+  BENCHMARK_RUN(frame802154_parse);
+  BENCHMARK_RUN(route_lookup);
+  BENCHMARK_RUN(sicslowpan_compress);
+  BENCHMARK_RUN(jsonparse_document);
+  BENCHMARK_RUN(jsonstream_document);
+  BENCHMARK_RUN(jsonstream_chunks);
+  BENCHMARK_RUN(jsonstream_extract);
+  BENCHMARK_RUN(jsontree_rewalk_block);
+  BENCHMARK_RUN(jsontree_print_block);
+  BENCHMARK_RUN(cc2420_rx_ring);
+  BENCHMARK_RUN(chameleon_bitopt_pack);
+  BENCHMARK_RUN(chameleon_stream_pack);
+  BENCHMARK_RUN(chameleon_bitopt_unpack);
+  BENCHMARK_RUN(chameleon_stream_unpack);
+
+  check_rx_ring();
+
+  phase_skew_start();
+  PROCESS_WAIT_UNTIL(skew_done || etimer_expired(&skew_timer));
+  phase_skew_check();
+
+  if(failures > 0) {
+    printf("benchmarks failed (%d)\n", failures);
+  } else {
+    printf("benchmarks ok\n");
+  }
+
+#if CONTIKI_TARGET_NATIVE
+  exit(failures > 0);
+#endif /* CONTIKI_TARGET_NATIVE */
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         A simulated CC2420 RX FIFO behind the SPI bus declared in
+ *         cc2420-sim.h.
+ */
+
+#include "contiki.h"
+#include "dev/cc2420.h"
+#include "dev/cc2420_const.h"
+#include "cc2420-sim.h"
+
+#include <string.h>
+
+#define FIFO_SIZE 128
+
+uint8_t cc2420_sim_txbuf, cc2420_sim_rxbuf;
+int cc2420_sim_selected, cc2420_sim_first;
+
+static uint8_t fifo[FIFO_SIZE];
+static int fifo_len;
+static int overflow;
+static uint8_t command;
+/*---------------------------------------------------------------------------*/
+void
+cc2420_arch_init(void)
+{
+}
+/*---------------------------------------------------------------------------*/
+/* Clock one byte over the bus. The first byte after the chip select
+   is the command, to which the radio answers with its status. */
+void
+cc2420_sim_clock(void)
+{
+  if(cc2420_sim_first) {
+    cc2420_sim_first = 0;
+    command = cc2420_sim_txbuf;
+    cc2420_sim_rxbuf = BV(CC2420_XOSC16M_STABLE);
+    if(command == CC2420_SFLUSHRX) {
+      fifo_len = 0;
+      overflow = 0;
+    }
+    return;
+  }
+  cc2420_sim_rxbuf = 0;
+  if(command == (CC2420_RXFIFO | 0x40) && fifo_len > 0) {
+    cc2420_sim_rxbuf = fifo[0];
+    memmove(fifo, fifo + 1, --fifo_len);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* FIFOP is set when a whole frame is in the FIFO or the FIFO has
+   overflowed, and FIFO is cleared by an overflow. */
+int
+cc2420_sim_fifop(void)
+{
+  return overflow || (fifo_len > 0 && fifo_len > fifo[0]);
+}
+/*---------------------------------------------------------------------------*/
+int
+cc2420_sim_fifo(void)
+{
+  return fifo_len > 0 && !overflow;
+}
+/*---------------------------------------------------------------------------*/
+void
+cc2420_sim_receive(uint8_t tag, int len, int crc_ok)
+{
+  int i;
+
+  if(fifo_len + len + 3 > FIFO_SIZE) {
+    overflow = 1;
+  } else {
+    fifo[fifo_len++] = len + 2;
+    for(i = 0; i < len; i++) {
+      fifo[fifo_len++] = tag;
+    }
+    fifo[fifo_len++] = 0xd0;
+    fifo[fifo_len++] = crc_ok ? 0x80 | 100 : 100;
+  }
+  cc2420_interrupt();
+}
+/*---------------------------------------------------------------------------*/
+int
+cc2420_sim_fifo_len(void)
+{
+  return fifo_len;
+}
+/*---------------------------------------------------------------------------*/
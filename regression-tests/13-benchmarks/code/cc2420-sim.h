@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/**
+ * \file
+ *         The SPI bus and pins of a simulated CC2420, so that the
+ *         driver in core/dev/cc2420.c runs on the native platform.
+ *         The file is included in front of the driver only.
+ */
+
+#ifndef __CC2420_SIM_H__
+#define __CC2420_SIM_H__
+
+#include <stdint.h>
+
+extern uint8_t cc2420_sim_txbuf, cc2420_sim_rxbuf;
+extern int cc2420_sim_selected, cc2420_sim_first;
+
+void cc2420_sim_clock(void);
+int cc2420_sim_fifop(void);
+int cc2420_sim_fifo(void);
+
+#define SPI_TXBUF cc2420_sim_txbuf
+#define SPI_RXBUF cc2420_sim_rxbuf
+#define SPI_WAITFOREOTx() cc2420_sim_clock()
+#define SPI_WAITFOREORx() cc2420_sim_clock()
+
+#define CC2420_SPI_ENABLE() (cc2420_sim_selected = 1, cc2420_sim_first = 1)
+#define CC2420_SPI_DISABLE() (cc2420_sim_selected = 0)
+#define CC2420_SPI_IS_ENABLED() cc2420_sim_selected
+
+#define CC2420_FIFOP_IS_1 cc2420_sim_fifop()
+#define CC2420_FIFO_IS_1 cc2420_sim_fifo()
+#define CC2420_SFD_IS_1 0
+#define CC2420_CCA_IS_1 1
+
+#define CC2420_CLEAR_FIFOP_INT()
+#define CC2420_ENABLE_FIFOP_INT()
+#define CC2420_DISABLE_FIFOP_INT()
+#define CC2420_FIFOP_INT_INIT()
+#define SET_VREG_ACTIVE()
+#define SET_VREG_INACTIVE()
+#define SET_RESET_ACTIVE()
+#define SET_RESET_INACTIVE()
+
+#define CC2420_CONF_SYMBOL_LOOP_COUNT 100
+
+#ifndef BV
+#define BV(x) (1 << (x))
+#endif
+
+static inline int splhigh(void) { return 0; }
+static inline void splx(int s) { (void)s; }
+
+#endif /* __CC2420_SIM_H__ */
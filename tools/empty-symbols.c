@@ -2,3 +2,4 @@
 
 const int symbols_nelts = 0;
 const struct symbols symbols[] = {{0,0}};
+const struct symbols_hash symbols_hash = {0, 0, 0, 0};
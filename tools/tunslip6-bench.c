@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2012, Swedish Institute of Computer Science.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the Institute nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE INSTITUTE AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE INSTITUTE OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * This file is part of the Contiki operating system.
+ *
+ */
+
+/*
+ * Throughput benchmark for tunslip6.
+ *
+ * Starts tunslip6 on one side of a pseudo terminal pair and acts as
+ * the radio on the other side. It first writes SLIP frames to the
+ * serial line as fast as tunslip6 takes them, then sends UDP packets
+ * through the tun interface and reads their SLIP frames back, and
+ * reports the throughput and the CPU time that tunslip6 used in each
+ * direction. Must be run as root, since tunslip6 creates the tun
+ * interface. Linux only, since the CPU time is read from /proc.
+ *
+ * usage: tunslip6-bench [-n packets] [-l length] [-t tundev] [tunslip6]
+ */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <termios.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <err.h>
+
+#define SLIP_END     0300
+#define SLIP_ESC     0333
+#define SLIP_ESC_END 0334
+#define SLIP_ESC_ESC 0335
+
+#define PREFIX       "aaaa::"
+#define IPADDR       PREFIX "1/64"
+#define PEER         PREFIX "2"
+#define UDP_PORT     5678
+
+/* The size of the IPv6 and UDP headers of the packets read back. */
+#define HEADERS      48
+
+pid_t child;
+
+double
+now(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+/* The CPU time, in seconds, that a process has used. */
+double
+cpu_time(pid_t pid)
+{
+  char path[32], buf[512], *p;
+  unsigned long utime, stime;
+  FILE *f;
+  int i;
+
+  snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+  f = fopen(path, "r");
+  if(f == NULL || fgets(buf, sizeof(buf), f) == NULL) {
+    err(1, "%s", path);
+  }
+  fclose(f);
+  /* Skip the command name, which may contain spaces, and the fields
+     up to utime, the 14th. */
+  p = strrchr(buf, ')');
+  for(i = 0; i < 12 && p != NULL; i++) {
+    p = strchr(p + 1, ' ');
+  }
+  if(p == NULL || sscanf(p, "%lu %lu", &utime, &stime) != 2) {
+    errx(1, "can't parse %s", path);
+  }
+  return (double)(utime + stime) / sysconf(_SC_CLK_TCK);
+}
+
+int
+slip_encode(unsigned char *frame, const unsigned char *p, int len)
+{
+  int i, n;
+
+  n = 0;
+  for(i = 0; i < len; i++) {
+    if(p[i] == SLIP_END) {
+      frame[n++] = SLIP_ESC;
+      frame[n++] = SLIP_ESC_END;
+    } else if(p[i] == SLIP_ESC) {
+      frame[n++] = SLIP_ESC;
+      frame[n++] = SLIP_ESC_ESC;
+    } else {
+      frame[n++] = p[i];
+    }
+  }
+  frame[n++] = SLIP_END;
+  return n;
+}
+
+/* Fill a packet with an IPv6 header with no next header, from the
+   peer to the tun interface, and a random payload. */
+void
+make_packet(unsigned char *p, int len)
+{
+  struct in6_addr addr;
+  int i;
+
+  memset(p, 0, 40);
+  p[0] = 0x60;
+  p[4] = (len - 40) >> 8;
+  p[5] = (len - 40) & 0xff;
+  p[6] = 59;
+  p[7] = 64;
+  inet_pton(AF_INET6, PEER, &addr);
+  memcpy(&p[8], &addr, 16);
+  inet_pton(AF_INET6, PREFIX "1", &addr);
+  memcpy(&p[24], &addr, 16);
+  for(i = 40; i < len; i++) {
+    p[i] = random();
+  }
+}
+
+void
+report(const char *direction, int packets, int bytes, double t, double cpu)
+{
+  printf("%-14s %6d packets %9d bytes %8.3f s %8.1f kB/s  tunslip6 CPU %.3f s (%.1f us/packet)\n",
+         direction, packets, bytes, t, bytes / t / 1000, cpu,
+         cpu * 1e6 / packets);
+}
+
+void
+kill_child(void)
+{
+  if(child > 0) {
+    kill(child, SIGTERM);
+    waitpid(child, NULL, 0);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  const char *tunslip6 = "./tunslip6";
+  const char *tundev = "tunbench0";
+  int npackets = 10000;
+  int len = 1280;
+  unsigned char *packet, *frame, *buf;
+  struct sockaddr_in6 peer;
+  struct termios tty;
+  double t, cpu;
+  int master, sock, c, i, n, framelen, total, frames;
+
+  while((c = getopt(argc, argv, "n:l:t:")) != -1) {
+    switch(c) {
+    case 'n':
+      npackets = atoi(optarg);
+      break;
+    case 'l':
+      len = atoi(optarg);
+      break;
+    case 't':
+      tundev = optarg;
+      break;
+    default:
+      errx(1, "usage: %s [-n packets] [-l length] [-t tundev] [tunslip6]",
+           argv[0]);
+    }
+  }
+  if(optind < argc) {
+    tunslip6 = argv[optind];
+  }
+  if(len < HEADERS || len > 1500) {
+    errx(1, "the packet length must be %d to 1500 bytes", HEADERS);
+  }
+
+  master = posix_openpt(O_RDWR | O_NOCTTY);
+  if(master == -1 || grantpt(master) == -1 || unlockpt(master) == -1) {
+    err(1, "posix_openpt");
+  }
+  if(tcgetattr(master, &tty) == -1) err(1, "tcgetattr");
+  cfmakeraw(&tty);
+  if(tcsetattr(master, TCSANOW, &tty) == -1) err(1, "tcsetattr");
+
+  child = fork();
+  if(child == -1) {
+    err(1, "fork");
+  } else if(child == 0) {
+    freopen("/dev/null", "w", stdout);
+    execl(tunslip6, tunslip6, "-v0", "-s", ptsname(master), "-t", tundev,
+          IPADDR, (char *)NULL);
+    err(1, "exec %s", tunslip6);
+  }
+  atexit(kill_child);
+  /* Let tunslip6 configure the interface. */
+  sleep(2);
+  tcflush(master, TCIFLUSH);
+
+  packet = malloc(len);
+  frame = malloc(2 * len + 1);
+  buf = malloc(65536);
+  if(packet == NULL || frame == NULL || buf == NULL) {
+    err(1, "malloc");
+  }
+
+  /* Serial to tun: tunslip6 writes the packets to the tun interface,
+     where the kernel drops them, so the writes to the pseudo terminal
+     are as fast as tunslip6 reads them. */
+  make_packet(packet, len);
+  framelen = slip_encode(frame, packet, len);
+  cpu = cpu_time(child);
+  t = now();
+  for(i = 0; i < npackets; i++) {
+    for(n = 0; n < framelen; ) {
+      c = write(master, frame + n, framelen - n);
+      if(c == -1 && errno != EINTR) {
+        err(1, "write");
+      }
+      n += c > 0 ? c : 0;
+    }
+  }
+  tcdrain(master);
+  report("serial to tun", npackets, npackets * len, now() - t,
+         cpu_time(child) - cpu);
+
+  /* Tun to serial: send UDP packets to the peer through the tun
+     interface, and read their frames from the pseudo terminal. */
+  sock = socket(AF_INET6, SOCK_DGRAM, 0);
+  if(sock == -1) err(1, "socket");
+  memset(&peer, 0, sizeof(peer));
+  peer.sin6_family = AF_INET6;
+  peer.sin6_port = htons(UDP_PORT);
+  inet_pton(AF_INET6, PEER, &peer.sin6_addr);
+  fcntl(sock, F_SETFL, O_NONBLOCK);
+
+  cpu = cpu_time(child);
+  t = now();
+  total = frames = i = 0;
+  while(frames < npackets) {
+    /* Keep a few packets in flight, without overflowing the queue of
+       the tun interface. */
+    while(i < npackets && i - frames < 32) {
+      if(sendto(sock, packet + HEADERS, len - HEADERS, 0,
+                (struct sockaddr *)&peer, sizeof(peer)) == -1) {
+        if(errno == EAGAIN || errno == ENOBUFS) {
+          break;
+        }
+        err(1, "sendto");
+      }
+      i++;
+    }
+    n = read(master, buf, 65536);
+    if(n == -1) {
+      err(1, "read");
+    }
+    for(c = 0; c < n; c++) {
+      if(buf[c] == SLIP_END) {
+        frames++;
+      }
+    }
+    total += n;
+  }
+  report("tun to serial", npackets, total, now() - t, cpu_time(child) - cpu);
+
+  return 0;
+}
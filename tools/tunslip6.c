@@ -41,6 +41,8 @@
 #include <string.h>
 #include <time.h>
 #include <sys/types.h>
+#include <sys/time.h>
+#include <sys/uio.h>
 
 #include <unistd.h>
 #include <errno.h>
@@ -54,27 +56,78 @@
 #include <arpa/inet.h>
 #include <netdb.h>
 
+#ifdef linux
+#include <sys/epoll.h>
+#endif
+
 #include <err.h>
 
 int verbose = 1;
-const char *ipaddr;
-const char *netmask;
-int slipfd = 0;
-uint16_t basedelay=0,delaymsec=0;
-uint32_t startsec,startmsec,delaystartsec,delaystartmsec;
+uint16_t basedelay=0;
 int timestamp = 0, flowcontrol=0;
 
 int ssystem(const char *fmt, ...)
      __attribute__((__format__ (__printf__, 1, 2)));
-void write_to_serial(int outfd, void *inbuf, int len);
-
-void slip_send(int fd, unsigned char c);
-void slip_send_char(int fd, unsigned char c);
 
 //#define PROGRESS(s) fprintf(stderr, s)
 #define PROGRESS(s) do { } while (0)
 
-char tundev[32] = { "" };
+/* The number of serial line and tun interface pairs that one process
+   can bridge. */
+#define MAX_BRIDGES 8
+
+#define MAX_PACKET 2000
+/* A SLIP frame is at most twice the size of its packet, plus the
+   SLIP_END. */
+#define MAX_FRAME (2 * MAX_PACKET + 1)
+/* The number of SLIP frames that can be queued for the serial line. */
+#define TX_QUEUE 8
+/* The number of bytes read from the serial line at once. */
+#define RX_BLOCK 4096
+
+struct frame {
+  int len;
+  unsigned char data[MAX_FRAME];
+};
+
+struct bridge {
+  int slipfd;
+  int tunfd;
+  char tundev[32];
+  const char *siodev;
+  const char *host;
+  const char *port;
+  const char *ipaddr;
+
+  /* The packet being decoded from the serial line. */
+  unsigned char inbuf[MAX_PACKET];
+  int inbufptr;
+  int esc;
+
+  /* The SLIP frames waiting to be written to the serial line. The
+     first tx_offset bytes of the first frame have been written. */
+  struct frame tx[TX_QUEUE];
+  int tx_head, tx_count, tx_offset;
+
+  /* Optional delay between outgoing packets. */
+  uint16_t delaymsec;
+  uint32_t delaystartsec, delaystartmsec;
+
+  /* The events that are watched for, and the ones that occured, on
+     the serial line and the tun interface. */
+  int slip_events, tun_events;
+  int slip_ready, tun_ready;
+};
+
+struct bridge bridges[MAX_BRIDGES];
+int nbridges;
+
+#define EV_READ  1
+#define EV_WRITE 2
+
+#ifdef linux
+int epfd;
+#endif
 
 int
 ssystem(const char *fmt, ...) __attribute__((__format__ (__printf__, 1, 2)));
@@ -97,6 +150,10 @@ ssystem(const char *fmt, ...)
 #define SLIP_ESC_END 0334
 #define SLIP_ESC_ESC 0335
 
+/* Nonzero for the bytes that have to be escaped in a SLIP frame. The
+   codec copies the runs of other bytes between them as whole blocks. */
+unsigned char slip_special[256];
+
 
 /* get sockaddr, IPv4 or IPv6: */
 void *
@@ -151,234 +208,336 @@ is_sensible_string(const unsigned char *s, int len)
 }
 
 /*
- * Read from serial, when we have a packet write it to tun. No output
- * buffering, input buffered by stdio.
+ * Encode a packet as a SLIP frame. Returns the length of the frame,
+ * which is at most 2 * len + 1 bytes.
  */
+int
+slip_encode(unsigned char *frame, const unsigned char *p, int len)
+{
+  const unsigned char *end = p + len;
+  const unsigned char *run;
+  unsigned char *f = frame;
+
+  /* It would be ``nice'' to send a SLIP_END first but it's not
+   * really necessary.
+   */
+  while(p < end) {
+    for(run = p; run < end && !slip_special[*run]; run++);
+    memcpy(f, p, run - p);
+    f += run - p;
+    if(run == end) {
+      break;
+    }
+    *f++ = SLIP_ESC;
+    *f++ = *run == SLIP_END ? SLIP_ESC_END : SLIP_ESC_ESC;
+    p = run + 1;
+  }
+  *f++ = SLIP_END;
+  return f - frame;
+}
+
+struct frame *
+slip_alloc(struct bridge *b)
+{
+  if(b->tx_count == TX_QUEUE) {
+    return NULL;
+  }
+  return &b->tx[(b->tx_head + b->tx_count) % TX_QUEUE];
+}
+
 void
-serial_to_tun(FILE *inslip, int outfd)
+slip_queue(struct bridge *b, const unsigned char *p, int len)
 {
-  static union {
-    unsigned char inbuf[2000];
-  } uip;
-  static int inbufptr = 0;
-  int ret,i;
-  unsigned char c;
+  struct frame *f;
 
-#ifdef linux
-  ret = fread(&c, 1, 1, inslip);
-  if(ret == -1 || ret == 0) err(1, "serial_to_tun: read");
-  goto after_fread;
-#endif
+  f = slip_alloc(b);
+  if(f == NULL) {
+    if(timestamp) stamptime();
+    fprintf(stderr, "*** %s: serial output queue full, dropping packet\n",
+            b->tundev);
+    return;
+  }
+  f->len = slip_encode(f->data, p, len);
+  b->tx_count++;
+}
+
+int
+slip_empty(struct bridge *b)
+{
+  return b->tx_count == 0;
+}
 
- read_more:
-  if(inbufptr >= sizeof(uip.inbuf)) {
-     if(timestamp) stamptime();
-     fprintf(stderr, "*** dropping large %d byte packet\n",inbufptr);
-	 inbufptr = 0;
+/*
+ * Write as much as possible of the queued SLIP frames to the serial
+ * line, with a single system call.
+ */
+void
+slip_flushbuf(struct bridge *b)
+{
+  struct iovec iov[TX_QUEUE];
+  struct frame *f;
+  int i, n, left;
+
+  if(slip_empty(b)) {
+    return;
   }
-  ret = fread(&c, 1, 1, inslip);
-#ifdef linux
- after_fread:
-#endif
-  if(ret == -1) {
-    err(1, "serial_to_tun: read");
+
+  for(i = 0; i < b->tx_count; i++) {
+    f = &b->tx[(b->tx_head + i) % TX_QUEUE];
+    iov[i].iov_base = f->data;
+    iov[i].iov_len = f->len;
   }
-  if(ret == 0) {
-    clearerr(inslip);
+  iov[0].iov_base = (unsigned char *)iov[0].iov_base + b->tx_offset;
+  iov[0].iov_len -= b->tx_offset;
+
+  n = writev(b->slipfd, iov, b->tx_count);
+
+  if(n == -1 && errno != EAGAIN) {
+    err(1, "slip_flushbuf write failed");
+  } else if(n == -1) {
+    PROGRESS("Q");		/* Outqueueis full! */
+  } else {
+    while(n > 0) {
+      left = b->tx[b->tx_head].len - b->tx_offset;
+      if(n < left) {
+        b->tx_offset += n;
+        break;
+      }
+      n -= left;
+      b->tx_offset = 0;
+      b->tx_head = (b->tx_head + 1) % TX_QUEUE;
+      b->tx_count--;
+    }
+  }
+}
+
+/*
+ * A SLIP_END has been received: write the packet to tun, or handle it
+ * if it is a request or a debug message from the radio.
+ */
+void
+packet_input(struct bridge *b)
+{
+  int i;
+
+  if(b->inbufptr == 0) {
     return;
   }
-  /*  fprintf(stderr, ".");*/
-  switch(c) {
-  case SLIP_END:
-    if(inbufptr > 0) {
-      if(uip.inbuf[0] == '!') {
-	if(uip.inbuf[1] == 'M') {
-	  /* Read gateway MAC address and autoconfigure tap0 interface */
-	  char macs[24];
-	  int i, pos;
-	  for(i = 0, pos = 0; i < 16; i++) {
-	    macs[pos++] = uip.inbuf[2 + i];
-	    if((i & 1) == 1 && i < 14) {
-	      macs[pos++] = ':';
-	    }
-	  }
-          if(timestamp) stamptime();
-	  macs[pos] = '\0';
-//	  printf("*** Gateway's MAC address: %s\n", macs);
-	  fprintf(stderr,"*** Gateway's MAC address: %s\n", macs);
-          if (timestamp) stamptime();
-	  ssystem("ifconfig %s down", tundev);
-          if (timestamp) stamptime();
-	  ssystem("ifconfig %s hw ether %s", tundev, &macs[6]);
-          if (timestamp) stamptime();
-	  ssystem("ifconfig %s up", tundev);
+  if(b->inbuf[0] == '!') {
+    if(b->inbuf[1] == 'M') {
+      /* Read gateway MAC address and autoconfigure tap0 interface */
+      char macs[24];
+      int i, pos;
+      for(i = 0, pos = 0; i < 16; i++) {
+	macs[pos++] = b->inbuf[2 + i];
+	if((i & 1) == 1 && i < 14) {
+	  macs[pos++] = ':';
 	}
-      } else if(uip.inbuf[0] == '?') {
-	if(uip.inbuf[1] == 'P') {
-          /* Prefix info requested */
-          struct in6_addr addr;
-	  int i;
-	  char *s = strchr(ipaddr, '/');
-	  if(s != NULL) {
-	    *s = '\0';
-	  }
-          inet_pton(AF_INET6, ipaddr, &addr);
-          if(timestamp) stamptime();
-          fprintf(stderr,"*** Address:%s => %02x%02x:%02x%02x:%02x%02x:%02x%02x\n",
+      }
+      if(timestamp) stamptime();
+      macs[pos] = '\0';
+//	  printf("*** Gateway's MAC address: %s\n", macs);
+      fprintf(stderr,"*** Gateway's MAC address: %s\n", macs);
+      if (timestamp) stamptime();
+      ssystem("ifconfig %s down", b->tundev);
+      if (timestamp) stamptime();
+      ssystem("ifconfig %s hw ether %s", b->tundev, &macs[6]);
+      if (timestamp) stamptime();
+      ssystem("ifconfig %s up", b->tundev);
+    }
+  } else if(b->inbuf[0] == '?') {
+    if(b->inbuf[1] == 'P') {
+      /* Prefix info requested */
+      struct in6_addr addr;
+      unsigned char reply[10];
+      char prefix[64];
+      char *s;
+      strncpy(prefix, b->ipaddr, sizeof(prefix) - 1);
+      prefix[sizeof(prefix) - 1] = '\0';
+      s = strchr(prefix, '/');
+      if(s != NULL) {
+	*s = '\0';
+      }
+      inet_pton(AF_INET6, prefix, &addr);
+      if(timestamp) stamptime();
+      fprintf(stderr,"*** Address:%s => %02x%02x:%02x%02x:%02x%02x:%02x%02x\n",
  //         printf("*** Address:%s => %02x%02x:%02x%02x:%02x%02x:%02x%02x\n",
-		 ipaddr, 
-		 addr.s6_addr[0], addr.s6_addr[1],
-		 addr.s6_addr[2], addr.s6_addr[3],
-		 addr.s6_addr[4], addr.s6_addr[5],
-		 addr.s6_addr[6], addr.s6_addr[7]);
-	  slip_send(slipfd, '!');
-	  slip_send(slipfd, 'P');
-	  for(i = 0; i < 8; i++) {
-	    /* need to call the slip_send_char for stuffing */
-	    slip_send_char(slipfd, addr.s6_addr[i]);
-	  }
-	  slip_send(slipfd, SLIP_END);
-        }
+	     prefix,
+	     addr.s6_addr[0], addr.s6_addr[1],
+	     addr.s6_addr[2], addr.s6_addr[3],
+	     addr.s6_addr[4], addr.s6_addr[5],
+	     addr.s6_addr[6], addr.s6_addr[7]);
+      reply[0] = '!';
+      reply[1] = 'P';
+      memcpy(&reply[2], addr.s6_addr, 8);
+      slip_queue(b, reply, sizeof(reply));
+    }
 #define DEBUG_LINE_MARKER '\r'
-      } else if(uip.inbuf[0] == DEBUG_LINE_MARKER) {    
-	fwrite(uip.inbuf + 1, inbufptr - 1, 1, stdout);
-      } else if(is_sensible_string(uip.inbuf, inbufptr)) {
-        if(verbose==1) {   /* strings already echoed below for verbose>1 */
-          if (timestamp) stamptime();
-          fwrite(uip.inbuf, inbufptr, 1, stdout);
-        }
-      } else {
-        if(verbose>2) {
-          if (timestamp) stamptime();
-          printf("Packet from SLIP of length %d - write TUN\n", inbufptr);
-          if (verbose>4) {
+  } else if(b->inbuf[0] == DEBUG_LINE_MARKER) {
+    fwrite(b->inbuf + 1, b->inbufptr - 1, 1, stdout);
+  } else if(is_sensible_string(b->inbuf, b->inbufptr)) {
+    if(verbose==1) {   /* strings already echoed below for verbose>1 */
+      if (timestamp) stamptime();
+      fwrite(b->inbuf, b->inbufptr, 1, stdout);
+    }
+  } else {
+    if(verbose>2) {
+      if (timestamp) stamptime();
+      printf("Packet from SLIP of length %d - write TUN\n", b->inbufptr);
+      if (verbose>4) {
 #if WIRESHARK_IMPORT_FORMAT
-            printf("0000");
-	        for(i = 0; i < inbufptr; i++) printf(" %02x",uip.inbuf[i]);
+        printf("0000");
+	for(i = 0; i < b->inbufptr; i++) printf(" %02x",b->inbuf[i]);
 #else
-            printf("         ");
-            for(i = 0; i < inbufptr; i++) {
-              printf("%02x", uip.inbuf[i]);
-              if((i & 3) == 3) printf(" ");
-              if((i & 15) == 15) printf("\n         ");
-            }
-#endif
-            printf("\n");
-          }
+        printf("         ");
+        for(i = 0; i < b->inbufptr; i++) {
+          printf("%02x", b->inbuf[i]);
+          if((i & 3) == 3) printf(" ");
+          if((i & 15) == 15) printf("\n         ");
         }
-	if(write(outfd, uip.inbuf, inbufptr) != inbufptr) {
-	  err(1, "serial_to_tun: write");
-	}
+#endif
+        printf("\n");
       }
-      inbufptr = 0;
-    }
-    break;
-
-  case SLIP_ESC:
-    if(fread(&c, 1, 1, inslip) != 1) {
-      clearerr(inslip);
-      /* Put ESC back and give up! */
-      ungetc(SLIP_ESC, inslip);
-      return;
-    }
-
-    switch(c) {
-    case SLIP_ESC_END:
-      c = SLIP_END;
-      break;
-    case SLIP_ESC_ESC:
-      c = SLIP_ESC;
-      break;
     }
-    /* FALLTHROUGH */
-  default:
-    uip.inbuf[inbufptr++] = c;
-
-    /* Echo lines as they are received for verbose=2,3,5+ */
-    /* Echo all printable characters for verbose==4 */
-    if((verbose==2) || (verbose==3) || (verbose>4)) {
-      if(c=='\n') {
-        if(is_sensible_string(uip.inbuf, inbufptr)) {
-          if (timestamp) stamptime();
-          fwrite(uip.inbuf, inbufptr, 1, stdout);
-          inbufptr=0;
-        }
-      }
-    } else if(verbose==4) {
-      if(c == 0 || c == '\r' || c == '\n' || c == '\t' || (c >= ' ' && c <= '~')) {
-	fwrite(&c, 1, 1, stdout);
-        if(c=='\n') if(timestamp) stamptime();
-      }
+    if(write(b->tunfd, b->inbuf, b->inbufptr) != b->inbufptr) {
+      err(1, "serial_to_tun: write");
     }
-    
-    break;
   }
-
-  goto read_more;
+  b->inbufptr = 0;
 }
 
-unsigned char slip_buf[2000];
-int slip_end, slip_begin;
+void
+packet_overflow(struct bridge *b)
+{
+  if(timestamp) stamptime();
+  fprintf(stderr, "*** dropping large %d byte packet\n", b->inbufptr);
+  b->inbufptr = 0;
+}
 
+/*
+ * Add one decoded byte to the packet, and echo it for the verbosity
+ * levels that show the input as it arrives.
+ */
 void
-slip_send_char(int fd, unsigned char c)
+packet_byte(struct bridge *b, unsigned char c)
 {
-  switch(c) {
-  case SLIP_END:
-    slip_send(fd, SLIP_ESC);
-    slip_send(fd, SLIP_ESC_END);
-    break;
-  case SLIP_ESC:
-    slip_send(fd, SLIP_ESC);
-    slip_send(fd, SLIP_ESC_ESC);
-    break;
-  default:
-    slip_send(fd, c);
-    break;
+  if(b->inbufptr >= sizeof(b->inbuf)) {
+    packet_overflow(b);
+  }
+  b->inbuf[b->inbufptr++] = c;
+
+  /* Echo lines as they are received for verbose=2,3,5+ */
+  /* Echo all printable characters for verbose==4 */
+  if((verbose==2) || (verbose==3) || (verbose>4)) {
+    if(c=='\n') {
+      if(is_sensible_string(b->inbuf, b->inbufptr)) {
+        if (timestamp) stamptime();
+        fwrite(b->inbuf, b->inbufptr, 1, stdout);
+        b->inbufptr=0;
+      }
+    }
+  } else if(verbose==4) {
+    if(c == 0 || c == '\r' || c == '\n' || c == '\t' || (c >= ' ' && c <= '~')) {
+      fwrite(&c, 1, 1, stdout);
+      if(c=='\n') if(timestamp) stamptime();
+    }
   }
 }
 
+/*
+ * Add a run of decoded bytes to the packet.
+ */
 void
-slip_send(int fd, unsigned char c)
+packet_bytes(struct bridge *b, const unsigned char *p, int len)
 {
-  if(slip_end >= sizeof(slip_buf)) {
-    err(1, "slip_send overflow");
+  int n;
+
+  if(verbose >= 2) {
+    while(len-- > 0) {
+      packet_byte(b, *p++);
+    }
+    return;
+  }
+
+  while(len > 0) {
+    if(b->inbufptr >= sizeof(b->inbuf)) {
+      packet_overflow(b);
+    }
+    n = sizeof(b->inbuf) - b->inbufptr;
+    if(n > len) {
+      n = len;
+    }
+    memcpy(b->inbuf + b->inbufptr, p, n);
+    b->inbufptr += n;
+    p += n;
+    len -= n;
   }
-  slip_buf[slip_end] = c;
-  slip_end++;
 }
 
-int
-slip_empty()
+/*
+ * Decode a block of SLIP input. An escape at the end of the block is
+ * completed by the next block.
+ */
+void
+slip_decode(struct bridge *b, const unsigned char *p, int len)
 {
-  return slip_end == 0;
+  const unsigned char *end = p + len;
+  const unsigned char *run;
+  unsigned char c;
+
+  while(p < end) {
+    if(b->esc) {
+      b->esc = 0;
+      c = *p++;
+      switch(c) {
+      case SLIP_ESC_END:
+	c = SLIP_END;
+	break;
+      case SLIP_ESC_ESC:
+	c = SLIP_ESC;
+	break;
+      }
+      packet_byte(b, c);
+      continue;
+    }
+
+    for(run = p; run < end && !slip_special[*run]; run++);
+    if(run > p) {
+      packet_bytes(b, p, run - p);
+      p = run;
+      continue;
+    }
+
+    if(*p++ == SLIP_END) {
+      packet_input(b);
+    } else {
+      b->esc = 1;
+    }
+  }
 }
 
+/*
+ * Read from serial, when we have a packet write it to tun.
+ */
 void
-slip_flushbuf(int fd)
+serial_to_tun(struct bridge *b)
 {
-  int n;
-  
-  if(slip_empty()) {
+  unsigned char buf[RX_BLOCK];
+  int ret;
+
+  ret = read(b->slipfd, buf, sizeof(buf));
+  if(ret == -1 && (errno == EAGAIN || errno == EINTR)) {
     return;
   }
-
-  n = write(fd, slip_buf + slip_begin, (slip_end - slip_begin));
-
-  if(n == -1 && errno != EAGAIN) {
-    err(1, "slip_flushbuf write failed");
-  } else if(n == -1) {
-    PROGRESS("Q");		/* Outqueueis full! */
-  } else {
-    slip_begin += n;
-    if(slip_begin == slip_end) {
-      slip_begin = slip_end = 0;
-    }
+  if(ret == -1 || ret == 0) {
+    err(1, "serial_to_tun: read");
   }
+  /*  fprintf(stderr, ".");*/
+  slip_decode(b, buf, ret);
 }
 
 void
-write_to_serial(int outfd, void *inbuf, int len)
+write_to_serial(struct bridge *b, void *inbuf, int len)
 {
   u_int8_t *p = inbuf;
   int i;
@@ -402,46 +561,36 @@ write_to_serial(int outfd, void *inbuf, int len)
     }
   }
 
-  /* It would be ``nice'' to send a SLIP_END here but it's not
-   * really necessary.
-   */
-  /* slip_send(outfd, SLIP_END); */
-
-  for(i = 0; i < len; i++) {
-    switch(p[i]) {
-    case SLIP_END:
-      slip_send(outfd, SLIP_ESC);
-      slip_send(outfd, SLIP_ESC_END);
-      break;
-    case SLIP_ESC:
-      slip_send(outfd, SLIP_ESC);
-      slip_send(outfd, SLIP_ESC_ESC);
-      break;
-    default:
-      slip_send(outfd, p[i]);
-      break;
-    }
-  }
-  slip_send(outfd, SLIP_END);
+  slip_queue(b, p, len);
   PROGRESS("t");
 }
 
 
 /*
- * Read from tun, write to slip.
+ * Read from tun, write to slip. Without a delay between the outgoing
+ * packets, all packets that are waiting are read while there is room
+ * for them in the serial output queue.
  */
 int
-tun_to_serial(int infd, int outfd)
+tun_to_serial(struct bridge *b)
 {
   struct {
-    unsigned char inbuf[2000];
+    unsigned char inbuf[MAX_PACKET];
   } uip;
-  int size;
-
-  if((size = read(infd, uip.inbuf, 2000)) == -1) err(1, "tun_to_serial: read");
+  int size, total;
 
-  write_to_serial(outfd, uip.inbuf, size);
-  return size;
+  total = 0;
+  do {
+    if((size = read(b->tunfd, uip.inbuf, MAX_PACKET)) == -1) {
+      if(errno == EAGAIN || errno == EINTR) {
+        break;
+      }
+      err(1, "tun_to_serial: read");
+    }
+    write_to_serial(b, uip.inbuf, size);
+    total += size;
+  } while(!basedelay && slip_alloc(b) != NULL);
+  return total;
 }
 
 #ifndef BAUDRATE
@@ -484,8 +633,11 @@ stty_telos(int fd)
   tty.c_cflag |= CLOCAL;
   if(tcsetattr(fd, TCSAFLUSH, &tty) == -1) err(1, "tcsetattr");
 
+  /* A pseudo terminal, as used by simulators, has no DTR line. */
   i = TIOCM_DTR;
-  if(ioctl(fd, TIOCMBIS, &i) == -1) err(1, "ioctl");
+  if(ioctl(fd, TIOCMBIS, &i) == -1 && errno != ENOTTY && errno != EINVAL) {
+    err(1, "ioctl");
+  }
 #endif
 
   usleep(10*1000);		/* Wait for hardware 10ms. */
@@ -542,13 +694,12 @@ tun_alloc(char *dev, int tap)
   return devopen(dev, O_RDWR);
 }
 #endif
-
 void
-cleanup(void)
+cleanup_bridge(struct bridge *b)
 {
 #ifndef __APPLE__
   if (timestamp) stamptime();
-  ssystem("ifconfig %s down", tundev);
+  ssystem("ifconfig %s down", b->tundev);
 #ifndef linux
   ssystem("sysctl -w net.ipv6.conf.all.forwarding=1");
 #endif
@@ -557,15 +708,15 @@ cleanup(void)
   ssystem("netstat -nr"
 	  " | awk '{ if ($2 == \"%s\") print \"route delete -net \"$1; }'"
 	  " | sh",
-	  tundev);
+	  b->tundev);
 #else
   {
-    char *  itfaddr = strdup(ipaddr);
+    char *  itfaddr = strdup(b->ipaddr);
     char *  prefix = index(itfaddr, '/');
     if (timestamp) stamptime();
-    ssystem("ifconfig %s inet6 %s remove", tundev, ipaddr);
+    ssystem("ifconfig %s inet6 %s remove", b->tundev, b->ipaddr);
     if (timestamp) stamptime();
-    ssystem("ifconfig %s down", tundev);
+    ssystem("ifconfig %s down", b->tundev);
     if ( prefix != NULL ) *prefix = '\0';
     ssystem("route delete -inet6 %s", itfaddr);
     free(itfaddr);
@@ -573,6 +724,18 @@ cleanup(void)
 #endif
 }
 
+void
+cleanup(void)
+{
+  int i;
+
+  for(i = 0; i < nbridges; i++) {
+    if(bridges[i].tunfd != -1) {
+      cleanup_bridge(&bridges[i]);
+    }
+  }
+}
+
 void
 sigcleanup(int signo)
 {
@@ -600,7 +763,6 @@ sigalarm_reset()
   ualarm(TIMEOUT, TIMEOUT);
   got_sigalarm = 0;
 }
-
 void
 ifconf(const char *tundev, const char *ipaddr)
 {
@@ -685,21 +847,211 @@ ifconf(const char *tundev, const char *ipaddr)
   ssystem("ifconfig %s\n", tundev);
 }
 
+/*
+ * Set the events to watch for on the serial line (tun == 0) or the
+ * tun interface (tun == 1) of a bridge. With epoll, the kernel is
+ * only told when they change.
+ */
+void
+watch(struct bridge *b, int tun, int events)
+{
+  int *current = tun ? &b->tun_events : &b->slip_events;
+#ifdef linux
+  struct epoll_event ev;
+
+  if(events == *current) {
+    return;
+  }
+  memset(&ev, 0, sizeof(ev));
+  ev.events = ((events & EV_READ) ? EPOLLIN : 0) |
+    ((events & EV_WRITE) ? EPOLLOUT : 0);
+  ev.data.u32 = (b - bridges) * 2 + tun;
+  if(epoll_ctl(epfd, EPOLL_CTL_MOD, tun ? b->tunfd : b->slipfd, &ev) == -1) {
+    err(1, "epoll_ctl");
+  }
+#endif
+  *current = events;
+}
+
+/*
+ * Wait for at most timeout milliseconds, or forever if timeout is -1,
+ * for the watched events, and record them in slip_ready and tun_ready.
+ */
+void
+wait_events(int timeout)
+{
+  struct bridge *b;
+  int i, ret;
+#ifdef linux
+  struct epoll_event ev[2 * MAX_BRIDGES];
+  int ready;
+
+  ret = epoll_wait(epfd, ev, 2 * MAX_BRIDGES, timeout);
+  if(ret == -1 && errno != EINTR) {
+    err(1, "epoll_wait");
+  }
+  for(i = 0; i < ret; i++) {
+    b = &bridges[ev[i].data.u32 / 2];
+    ready = ((ev[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) ? EV_READ : 0) |
+      ((ev[i].events & EPOLLOUT) ? EV_WRITE : 0);
+    if(ev[i].data.u32 & 1) {
+      b->tun_ready = ready & b->tun_events;
+    } else {
+      b->slip_ready = ready & b->slip_events;
+    }
+  }
+#else
+  fd_set rset, wset;
+  struct timeval tv;
+  int maxfd;
+
+  maxfd = 0;
+  FD_ZERO(&rset);
+  FD_ZERO(&wset);
+  for(i = 0; i < nbridges; i++) {
+    b = &bridges[i];
+    if(b->slip_events & EV_READ) FD_SET(b->slipfd, &rset);
+    if(b->slip_events & EV_WRITE) FD_SET(b->slipfd, &wset);
+    if(b->slipfd > maxfd) maxfd = b->slipfd;
+    if(b->tun_events & EV_READ) {
+      FD_SET(b->tunfd, &rset);
+      if(b->tunfd > maxfd) maxfd = b->tunfd;
+    }
+  }
+  tv.tv_sec = timeout / 1000;
+  tv.tv_usec = (timeout % 1000) * 1000;
+
+  ret = select(maxfd + 1, &rset, &wset, NULL, timeout == -1 ? NULL : &tv);
+  if(ret == -1 && errno != EINTR) {
+    err(1, "select");
+  } else if(ret > 0) {
+    for(i = 0; i < nbridges; i++) {
+      b = &bridges[i];
+      b->slip_ready = (FD_ISSET(b->slipfd, &rset) ? EV_READ : 0) |
+        (FD_ISSET(b->slipfd, &wset) ? EV_WRITE : 0);
+      b->tun_ready = FD_ISSET(b->tunfd, &rset) ? EV_READ : 0;
+    }
+  }
+#endif
+}
+
+/*
+ * Returns the number of milliseconds left of the delay before the
+ * next packet can be sent to the serial line of a bridge.
+ */
+int
+delay_left(struct bridge *b)
+{
+  /* Optional delay between outgoing packets */
+  /* Base delay times number of 6lowpan fragments to be sent */
+  if(b->delaymsec) {
+    struct timeval tv;
+    int dmsec;
+    gettimeofday(&tv, NULL) ;
+    dmsec=(tv.tv_sec-b->delaystartsec)*1000+tv.tv_usec/1000-b->delaystartmsec;
+    if(dmsec<0) b->delaymsec=0;
+    if(dmsec>b->delaymsec) b->delaymsec=0;
+    if(b->delaymsec) {
+      return b->delaymsec - dmsec;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Open the serial line of a bridge, either a device or a TCP
+ * connection to a simulated radio.
+ */
+void
+open_serial(struct bridge *b)
+{
+  if(b->host != NULL) {
+    struct addrinfo hints, *servinfo, *p;
+    int rv;
+    char s[INET6_ADDRSTRLEN];
+
+    if(b->port == NULL) {
+      b->port = "60001";
+    }
+
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if((rv = getaddrinfo(b->host, b->port, &hints, &servinfo)) != 0) {
+      err(1, "getaddrinfo: %s", gai_strerror(rv));
+    }
+
+    /* loop through all the results and connect to the first we can */
+    for(p = servinfo; p != NULL; p = p->ai_next) {
+      if((b->slipfd = socket(p->ai_family, p->ai_socktype,
+                             p->ai_protocol)) == -1) {
+        perror("client: socket");
+        continue;
+      }
+
+      if(connect(b->slipfd, p->ai_addr, p->ai_addrlen) == -1) {
+        close(b->slipfd);
+        perror("client: connect");
+        continue;
+      }
+      break;
+    }
+
+    if(p == NULL) {
+      err(1, "can't connect to ``%s:%s''", b->host, b->port);
+    }
+
+    fcntl(b->slipfd, F_SETFL, O_NONBLOCK);
+
+    inet_ntop(p->ai_family, get_in_addr((struct sockaddr *)p->ai_addr),
+              s, sizeof(s));
+    fprintf(stderr, "slip connected to ``%s:%s''\n", s, b->port);
+
+    /* all done with this structure */
+    freeaddrinfo(servinfo);
+
+  } else {
+    if(b->siodev != NULL) {
+      b->slipfd = devopen(b->siodev, O_RDWR | O_NONBLOCK);
+      if(b->slipfd == -1) {
+	err(1, "can't open siodev ``/dev/%s''", b->siodev);
+      }
+    } else if(b == &bridges[0]) {
+      static const char *siodevs[] = {
+        "ttyUSB0", "cuaU0", "ucom0" /* linux, fbsd6, fbsd5 */
+      };
+      int i;
+      for(i = 0; i < 3; i++) {
+        b->siodev = siodevs[i];
+        b->slipfd = devopen(b->siodev, O_RDWR | O_NONBLOCK);
+        if(b->slipfd != -1) {
+          break;
+        }
+      }
+      if(b->slipfd == -1) {
+        err(1, "can't open siodev");
+      }
+    } else {
+      errx(1, "no serial device for ``%s''", b->ipaddr);
+    }
+    if (timestamp) stamptime();
+    fprintf(stderr, "********SLIP started on ``/dev/%s''\n", b->siodev);
+    stty_telos(b->slipfd);
+  }
+}
+
 int
 main(int argc, char **argv)
 {
   int c;
-  int tunfd, maxfd;
-  int ret;
-  fd_set rset, wset;
-  FILE *inslip;
-  const char *siodev = NULL;
-  const char *host = NULL;
-  const char *port = NULL;
+  int i;
+  int timeout;
+  int nsiodevs = 0, ntundevs = 0, nhosts = 0, nports = 0;
+  struct bridge *b;
   const char *prog;
   int baudrate = -2;
   int tap = 0;
-  slipfd = 0;
 
   prog = argv[0];
   setvbuf(stdout, NULL, _IOLBF, 0); /* Line buffered output. */
@@ -719,27 +1071,39 @@ main(int argc, char **argv)
       break;
 
     case 's':
+      if(nsiodevs == MAX_BRIDGES) {
+	errx(1, "at most %d serial devices", MAX_BRIDGES);
+      }
       if(strncmp("/dev/", optarg, 5) == 0) {
-	siodev = optarg + 5;
+	bridges[nsiodevs++].siodev = optarg + 5;
       } else {
-	siodev = optarg;
+	bridges[nsiodevs++].siodev = optarg;
       }
       break;
 
     case 't':
+      if(ntundevs == MAX_BRIDGES) {
+	errx(1, "at most %d interfaces", MAX_BRIDGES);
+      }
       if(strncmp("/dev/", optarg, 5) == 0) {
-	strncpy(tundev, optarg + 5, sizeof(tundev));
+	strncpy(bridges[ntundevs++].tundev, optarg + 5, sizeof(bridges[0].tundev) - 1);
       } else {
-	strncpy(tundev, optarg, sizeof(tundev));
+	strncpy(bridges[ntundevs++].tundev, optarg, sizeof(bridges[0].tundev) - 1);
       }
       break;
 
     case 'a':
-      host = optarg;
+      if(nhosts == MAX_BRIDGES) {
+	errx(1, "at most %d server addresses", MAX_BRIDGES);
+      }
+      bridges[nhosts++].host = optarg;
       break;
 
     case 'p':
-      port = optarg;
+      if(nports == MAX_BRIDGES) {
+	errx(1, "at most %d server ports", MAX_BRIDGES);
+      }
+      bridges[nports++].port = optarg;
       break;
 
     case 'd':
@@ -759,7 +1123,7 @@ main(int argc, char **argv)
     case '?':
     case 'h':
     default:
-fprintf(stderr,"usage:  %s [options] ipaddress\n", prog);
+fprintf(stderr,"usage:  %s [options] ipaddress [ipaddress ...]\n", prog);
 fprintf(stderr,"example: tunslip6 -L -v2 -s ttyUSB1 aaaa::1/64\n");
 fprintf(stderr,"Options are:\n");
 #ifndef __APPLE__
@@ -785,6 +1149,9 @@ fprintf(stderr,"                Actual delay is basedelay*(#6LowPAN fragments) m
 fprintf(stderr,"                -d is equivalent to -d10.\n");
 fprintf(stderr," -a serveraddr  \n");
 fprintf(stderr," -p serverport  \n");
+fprintf(stderr,"Several radios are bridged by giving one ipaddress for each. The n:th\n");
+fprintf(stderr,"-s, -t, -a and -p options apply to the n:th ipaddress, and the\n");
+fprintf(stderr,"interfaces default to tun0, tun1, ... (or tap0, tap1, ...).\n");
 exit(1);
       break;
     }
@@ -792,10 +1159,19 @@ exit(1);
   argc -= (optind - 1);
   argv += (optind - 1);
 
-  if(argc != 2 && argc != 3) {
-    err(1, "usage: %s [-B baudrate] [-H] [-L] [-s siodev] [-t tundev] [-T] [-v verbosity] [-d delay] [-a serveraddress] [-p serverport] ipaddress", prog);
+  if(argc < 2 || argc - 1 > MAX_BRIDGES) {
+    err(1, "usage: %s [-B baudrate] [-H] [-L] [-s siodev] [-t tundev] [-T] [-v verbosity] [-d delay] [-a serveraddress] [-p serverport] ipaddress [ipaddress ...]", prog);
+  }
+  nbridges = argc - 1;
+  if(nsiodevs > nbridges || ntundevs > nbridges ||
+     nhosts > nbridges || nports > nbridges) {
+    errx(1, "more -s, -t, -a or -p options than ipaddresses");
+  }
+  for(i = 0; i < nbridges; i++) {
+    bridges[i].ipaddr = argv[1 + i];
+    bridges[i].slipfd = -1;
+    bridges[i].tunfd = -1;
   }
-  ipaddr = argv[1];
 
   switch(baudrate) {
   case -2:
@@ -830,170 +1206,120 @@ exit(1);
     err(1, "unknown baudrate %d", baudrate);
     break;
   }
+  slip_special[SLIP_END] = 1;
+  slip_special[SLIP_ESC] = 1;
 
-  if(*tundev == '\0') {
-    /* Use default. */
-    if(tap) {
-      strcpy(tundev, "tap0");
-    } else {
-      strcpy(tundev, "tun0");
-    }
-  }
-  if(host != NULL) {
-    struct addrinfo hints, *servinfo, *p;
-    int rv;
-    char s[INET6_ADDRSTRLEN];
-
-    if(port == NULL) {
-      port = "60001";
-    }
-
-    memset(&hints, 0, sizeof hints);
-    hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = SOCK_STREAM;
-
-    if((rv = getaddrinfo(host, port, &hints, &servinfo)) != 0) {
-      err(1, "getaddrinfo: %s", gai_strerror(rv));
-    }
+#ifdef linux
+  epfd = epoll_create(2 * MAX_BRIDGES);
+  if(epfd == -1) err(1, "epoll_create");
+#endif
 
-    /* loop through all the results and connect to the first we can */
-    for(p = servinfo; p != NULL; p = p->ai_next) {
-      if((slipfd = socket(p->ai_family, p->ai_socktype,
-                          p->ai_protocol)) == -1) {
-        perror("client: socket");
-        continue;
-      }
+  atexit(cleanup);
 
-      if(connect(slipfd, p->ai_addr, p->ai_addrlen) == -1) {
-        close(slipfd);
-        perror("client: connect");
-        continue;
-      }
-      break;
-    }
+  for(i = 0; i < nbridges; i++) {
+    b = &bridges[i];
 
-    if(p == NULL) {
-      err(1, "can't connect to ``%s:%s''", host, port);
+    if(*b->tundev == '\0') {
+      /* Use default. */
+      snprintf(b->tundev, sizeof(b->tundev), tap ? "tap%d" : "tun%d", i);
     }
+    open_serial(b);
+    /* Start with a SLIP_END, so that the radio discards any partial
+       frame it has received. */
+    b->tx[0].data[0] = SLIP_END;
+    b->tx[0].len = 1;
+    b->tx_count = 1;
+
+    b->tunfd = tun_alloc(b->tundev, tap);
+    if(b->tunfd == -1) err(1, "main: open");
+    fcntl(b->tunfd, F_SETFL, O_NONBLOCK);
+    if (timestamp) stamptime();
+    fprintf(stderr, "opened %s device ``/dev/%s''\n",
+            tap ? "tap" : "tun", b->tundev);
 
-    fcntl(slipfd, F_SETFL, O_NONBLOCK);
-
-    inet_ntop(p->ai_family, get_in_addr((struct sockaddr *)p->ai_addr),
-              s, sizeof(s));
-    fprintf(stderr, "slip connected to ``%s:%s''\n", s, port);
-
-    /* all done with this structure */
-    freeaddrinfo(servinfo);
-
-  } else {
-    if(siodev != NULL) {
-      slipfd = devopen(siodev, O_RDWR | O_NONBLOCK);
-      if(slipfd == -1) {
-	err(1, "can't open siodev ``/dev/%s''", siodev);
-      }
-    } else {
-      static const char *siodevs[] = {
-        "ttyUSB0", "cuaU0", "ucom0" /* linux, fbsd6, fbsd5 */
-      };
-      int i;
-      for(i = 0; i < 3; i++) {
-        siodev = siodevs[i];
-        slipfd = devopen(siodev, O_RDWR | O_NONBLOCK);
-        if(slipfd != -1) {
-          break;
-        }
+#ifdef linux
+    {
+      struct epoll_event ev;
+      memset(&ev, 0, sizeof(ev));
+      ev.data.u32 = i * 2;
+      if(epoll_ctl(epfd, EPOLL_CTL_ADD, b->slipfd, &ev) == -1) {
+        err(1, "epoll_ctl");
       }
-      if(slipfd == -1) {
-        err(1, "can't open siodev");
+      ev.data.u32 = i * 2 + 1;
+      if(epoll_ctl(epfd, EPOLL_CTL_ADD, b->tunfd, &ev) == -1) {
+        err(1, "epoll_ctl");
       }
     }
-    if (timestamp) stamptime();
-    fprintf(stderr, "********SLIP started on ``/dev/%s''\n", siodev);
-    stty_telos(slipfd);
+#endif
   }
-  slip_send(slipfd, SLIP_END);
-  inslip = fdopen(slipfd, "r");
-  if(inslip == NULL) err(1, "main: fdopen");
 
-  tunfd = tun_alloc(tundev, tap);
-  if(tunfd == -1) err(1, "main: open");
-  if (timestamp) stamptime();
-  fprintf(stderr, "opened %s device ``/dev/%s''\n",
-          tap ? "tap" : "tun", tundev);
-
-  atexit(cleanup);
   signal(SIGHUP, sigcleanup);
   signal(SIGTERM, sigcleanup);
   signal(SIGINT, sigcleanup);
   signal(SIGALRM, sigalarm);
-  ifconf(tundev, ipaddr);
+  for(i = 0; i < nbridges; i++) {
+    ifconf(bridges[i].tundev, bridges[i].ipaddr);
+  }
 
   while(1) {
-    maxfd = 0;
-    FD_ZERO(&rset);
-    FD_ZERO(&wset);
+    timeout = -1;
 
 /* do not send IPA all the time... - add get MAC later... */
 /*     if(got_sigalarm) { */
 /*       /\* Send "?IPA". *\/ */
-/*       slip_send(slipfd, '?'); */
-/*       slip_send(slipfd, 'I'); */
-/*       slip_send(slipfd, 'P'); */
-/*       slip_send(slipfd, 'A'); */
-/*       slip_send(slipfd, SLIP_END); */
+/*       slip_queue(b, "?IPA", 4); */
 /*       got_sigalarm = 0; */
 /*     } */
 
-    if(!slip_empty()) {		/* Anything to flush? */
-      FD_SET(slipfd, &wset);
+    for(i = 0; i < nbridges; i++) {
+      int delay;
+      b = &bridges[i];
+
+      /* Read from slip ASAP! Flush the output if there is anything
+         queued, and read from tun if there is room for the packet
+         and no delay to wait for. With a delay, only one packet at a
+         time is queued for slip output. */
+      watch(b, 0, EV_READ | (slip_empty(b) ? 0 : EV_WRITE));
+      delay = delay_left(b);
+      if(delay > 0) {
+        if(timeout == -1 || delay < timeout) {
+          timeout = delay;
+        }
+        watch(b, 1, 0);
+      } else if(basedelay ? slip_empty(b) : slip_alloc(b) != NULL) {
+        watch(b, 1, EV_READ);
+      } else {
+        watch(b, 1, 0);
+      }
+      b->slip_ready = b->tun_ready = 0;
     }
 
-    FD_SET(slipfd, &rset);	/* Read from slip ASAP! */
-    if(slipfd > maxfd) maxfd = slipfd;
-    
-    /* We only have one packet at a time queued for slip output. */
-    if(slip_empty()) {
-      FD_SET(tunfd, &rset);
-      if(tunfd > maxfd) maxfd = tunfd;
-    }
+    wait_events(timeout);
 
-    ret = select(maxfd + 1, &rset, &wset, NULL, NULL);
-    if(ret == -1 && errno != EINTR) {
-      err(1, "select");
-    } else if(ret > 0) {
-      if(FD_ISSET(slipfd, &rset)) {
-        serial_to_tun(inslip, tunfd);
+    for(i = 0; i < nbridges; i++) {
+      b = &bridges[i];
+
+      if(b->slip_ready & EV_READ) {
+        serial_to_tun(b);
       }
-      
-      if(FD_ISSET(slipfd, &wset)) {
-	slip_flushbuf(slipfd);
+
+      if(b->slip_ready & EV_WRITE) {
+	slip_flushbuf(b);
 	sigalarm_reset();
       }
- 
-      /* Optional delay between outgoing packets */
-      /* Base delay times number of 6lowpan fragments to be sent */
-      if(delaymsec) {
-       struct timeval tv;
-       int dmsec;
-       gettimeofday(&tv, NULL) ;
-       dmsec=(tv.tv_sec-delaystartsec)*1000+tv.tv_usec/1000-delaystartmsec;
-       if(dmsec<0) delaymsec=0;
-       if(dmsec>delaymsec) delaymsec=0;
-      }
-      if(delaymsec==0) {
-        int size;
-        if(slip_empty() && FD_ISSET(tunfd, &rset)) {
-          size=tun_to_serial(tunfd, slipfd);
-          slip_flushbuf(slipfd);
-          sigalarm_reset();
-          if(basedelay) {
-            struct timeval tv;
-            gettimeofday(&tv, NULL) ;
- //         delaymsec=basedelay*(1+(size/120));//multiply by # of 6lowpan packets?
-            delaymsec=basedelay;
-            delaystartsec =tv.tv_sec;
-            delaystartmsec=tv.tv_usec/1000;
-          }
+
+      if(delay_left(b) == 0 && (b->tun_ready & EV_READ) &&
+         slip_alloc(b) != NULL) {
+        tun_to_serial(b);
+        slip_flushbuf(b);
+        sigalarm_reset();
+        if(basedelay) {
+          struct timeval tv;
+          gettimeofday(&tv, NULL) ;
+ //         b->delaymsec=basedelay*(1+(size/120));//multiply by # of 6lowpan packets?
+          b->delaymsec=basedelay;
+          b->delaystartsec =tv.tv_sec;
+          b->delaystartmsec=tv.tv_usec/1000;
         }
       }
     }